@@ -0,0 +1,111 @@
+//==================== CONCURRENT HASH TABLE BENCHMARK ====================
+// Lookup and update throughput of ConcurrentHashTable from 1 to 64 threads,
+// for a read-mostly mix (95% finds) and an even one (50% finds). Writes are
+// split between inserts and removes over the same key range, so the table
+// stays near half full and keeps resizing shards as it goes.
+//
+//     g++ -std=c++17 -O2 -pthread ConcurrentHashTableBench.cpp -o bench
+//     ./bench [milliseconds per run]
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "../implementation/ConcurrentHashTable.cpp"
+
+namespace {
+
+const uint64_t KEY_RANGE = 1 << 20;
+const size_t THREAD_COUNTS[] = {1, 2, 4, 8, 16, 32, 64};
+
+struct Mix {
+    const char* name;
+    unsigned read_percent;
+};
+
+const Mix MIXES[] = {{"read-mostly", 95}, {"50/50", 50}};
+
+// xorshift64*, one per thread so the generator is not a shared line
+struct Random {
+    uint64_t state;
+    
+    explicit Random(uint64_t seed) : state(seed * 0x9E3779B97F4A7C15ULL | 1) {}
+    
+    uint64_t next() {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545F4914F6CDD1DULL;
+    }
+};
+
+// Runs one mix for the given time and returns millions of operations per second
+double run(const Mix& mix, size_t thread_count, int milliseconds) {
+    ConcurrentHashTable<uint64_t, uint64_t> table(64);
+    for (uint64_t key = 0; key < KEY_RANGE; key += 2) {
+        table.insert(key, key);
+    }
+    
+    std::atomic<bool> start(false);
+    std::atomic<bool> stop(false);
+    std::atomic<uint64_t> total(0);
+    std::atomic<uint64_t> hits(0);     // keeps the finds observable
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            Random random(t + 1);
+            uint64_t operations = 0;
+            uint64_t found = 0;
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            while (!stop.load(std::memory_order_relaxed)) {
+                // Check the clock flag only every 64 operations
+                for (int i = 0; i < 64; ++i) {
+                    uint64_t draw = random.next();
+                    uint64_t key = (draw >> 8) % KEY_RANGE;
+                    unsigned percent = static_cast<unsigned>(draw & 0xFF) % 100;
+                    if (percent < mix.read_percent) {
+                        uint64_t value;
+                        found += table.find(key, value);
+                    } else if (percent & 1) {
+                        table.insert(key, key);
+                    } else {
+                        table.remove(key);
+                    }
+                }
+                operations += 64;
+            }
+            total.fetch_add(operations);
+            hits.fetch_add(found);
+        });
+    }
+    
+    auto began = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+    stop.store(true);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - began).count();
+    return total.load() / seconds / 1e6;
+}
+
+}
+
+int main(int argc, char** argv) {
+    int milliseconds = argc > 1 ? std::atoi(argv[1]) : 500;
+    std::printf("%u hardware threads, %d ms per run, %llu keys\n", std::thread::hardware_concurrency(),
+                milliseconds, static_cast<unsigned long long>(KEY_RANGE));
+    std::printf("%-12s %8s %12s\n", "mix", "threads", "Mops/s");
+    for (const Mix& mix : MIXES) {
+        for (size_t thread_count : THREAD_COUNTS) {
+            std::printf("%-12s %8zu %12.2f\n", mix.name, thread_count, run(mix, thread_count, milliseconds));
+        }
+    }
+    return 0;
+}
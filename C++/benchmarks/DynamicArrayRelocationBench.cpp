@@ -0,0 +1,124 @@
+//==================== DYNAMIC ARRAY RELOCATION BENCHMARK ====================
+// Cost of moving elements inside a DynamicArray when the element type is
+// declared trivially relocatable (memcpy / memmove) against the element-wise
+// path (move construct, then destroy each element). Both element types wrap
+// a unique_ptr and differ only in the IsTriviallyRelocatable specialization.
+//
+//     reallocate  reserve one past the capacity, then shrinkToFit: two full moves
+//     insert      insert in the middle, shifting half the array right
+//     erase       erase from the middle, shifting half the array left
+//
+//     g++ -std=c++17 -O2 DynamicArrayRelocationBench.cpp -o bench
+//     ./bench [milliseconds per run]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <utility>
+#include "../implementation/vectors.cpp"
+
+template<bool Relocatable>
+struct Handle {
+    std::unique_ptr<uint64_t> value;
+    
+    Handle() = default;
+    explicit Handle(uint64_t v) : value(new uint64_t(v)) {}
+};
+
+// unique_ptr is a single owning pointer, so moving its bytes is a valid move
+template<>
+struct IsTriviallyRelocatable<Handle<true>> : std::true_type {};
+
+namespace {
+
+const size_t ELEMENT_COUNTS[] = {1 << 8, 1 << 12, 1 << 16};
+const size_t SHIFTS_PER_PASS = 64;
+
+volatile uint64_t sink = 0;     // keeps the arrays observable
+
+// Repeats pass for the given time and returns nanoseconds per operation
+template<typename Pass>
+double run(Pass pass, size_t operations_per_pass, int milliseconds) {
+    auto began = std::chrono::steady_clock::now();
+    auto deadline = began + std::chrono::milliseconds(milliseconds);
+    uint64_t passes = 0;
+    do {
+        pass();
+        ++passes;
+    } while (std::chrono::steady_clock::now() < deadline);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - began).count();
+    return seconds * 1e9 / (static_cast<double>(passes) * operations_per_pass);
+}
+
+struct Timings {
+    double reallocate;
+    double insert;
+    double erase;
+};
+
+template<bool Relocatable>
+Timings measure(size_t element_count, int milliseconds) {
+    using Element = Handle<Relocatable>;
+    static_assert(IsTriviallyRelocatable<Element>::value == Relocatable, "specialization not picked up");
+    
+    DynamicArray<Element> array(element_count);
+    for (size_t i = 0; i < element_count; ++i) {
+        array.push_back(Element(i));
+    }
+    DynamicArray<Element> spares(SHIFTS_PER_PASS);
+    for (size_t i = 0; i < SHIFTS_PER_PASS; ++i) {
+        spares.push_back(Element(i));
+    }
+    size_t middle = element_count / 2;
+    
+    Timings timings;
+    timings.reallocate = run([&]() {
+        array.reserve(array.getCapacity() + 1);
+        array.shrinkToFit();
+    }, 2, milliseconds);
+    // Insert and erase take their elements from the spares and give them back,
+    // so neither allocates nor frees a unique_ptr target inside the timed pass
+    timings.insert = run([&]() {
+        for (size_t i = 0; i < SHIFTS_PER_PASS; ++i) {
+            array.insert(middle, std::move(spares[i]));
+        }
+        for (size_t i = 0; i < SHIFTS_PER_PASS; ++i) {
+            spares[i] = std::move(array[middle + SHIFTS_PER_PASS - 1 - i]);
+        }
+        array.erase(middle, middle + SHIFTS_PER_PASS);
+    }, SHIFTS_PER_PASS, milliseconds);
+    timings.erase = run([&]() {
+        for (size_t i = 0; i < SHIFTS_PER_PASS; ++i) {
+            spares[i] = std::move(array[middle]);
+            array.erase(middle);
+        }
+        for (size_t i = 0; i < SHIFTS_PER_PASS; ++i) {
+            array.push_back(std::move(spares[i]));
+        }
+    }, SHIFTS_PER_PASS, milliseconds);
+    sink = sink + *array[middle].value;
+    return timings;
+}
+
+void report(const char* operation, size_t element_count, double element_wise, double relocated) {
+    std::printf("%-11s %10zu %14.1f %12.1f %8.2fx\n", operation, element_count, element_wise, relocated,
+                element_wise / relocated);
+}
+
+}
+
+int main(int argc, char** argv) {
+    int milliseconds = argc > 1 ? std::atoi(argv[1]) : 300;
+    std::printf("%d ms per run, %zu-byte elements, ns per operation\n", milliseconds, sizeof(Handle<true>));
+    std::printf("%-11s %10s %14s %12s %9s\n", "operation", "elements", "element-wise", "relocated", "speedup");
+    for (size_t element_count : ELEMENT_COUNTS) {
+        Timings element_wise = measure<false>(element_count, milliseconds);
+        Timings relocated = measure<true>(element_count, milliseconds);
+        report("reallocate", element_count, element_wise.reallocate, relocated.reallocate);
+        report("insert", element_count, element_wise.insert, relocated.insert);
+        report("erase", element_count, element_wise.erase, relocated.erase);
+    }
+    return 0;
+}
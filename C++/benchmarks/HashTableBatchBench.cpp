@@ -0,0 +1,107 @@
+//==================== HASH TABLE BATCH LOOKUP BENCHMARK ====================
+// Lookup throughput of HashTable::findBatch against a loop of find over the
+// same random keys, for tables from cache-resident to well past the last
+// level cache, in the linear, group and cuckoo probing modes. Half of the
+// probed keys are present. Once the table outgrows the cache a plain find
+// waits on one miss at a time, while findBatch keeps BATCH_SIZE in flight.
+//
+//     g++ -std=c++17 -O2 HashTableBatchBench.cpp -o bench
+//     ./bench [milliseconds per run]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include "../implementation/HashTable.cpp"
+#include "../implementation/vectors.cpp"
+
+namespace {
+
+const size_t TABLE_SIZES[] = {1 << 12, 1 << 16, 1 << 20, 1 << 22};
+const size_t PROBE_COUNT = 1 << 20;     // keys per pass, drawn from the whole table so they miss the cache
+
+struct Mode {
+    const char* name;
+    ProbingMode mode;
+};
+
+const Mode MODES[] = {{"linear", ProbingMode::Linear}, {"group", ProbingMode::Group}, {"cuckoo", ProbingMode::Cuckoo}};
+
+// xorshift64*
+struct Random {
+    uint64_t state;
+    
+    explicit Random(uint64_t seed) : state(seed * 0x9E3779B97F4A7C15ULL | 1) {}
+    
+    uint64_t next() {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545F4914F6CDD1DULL;
+    }
+};
+
+volatile uint64_t sink = 0;     // keeps the lookups observable
+
+// Repeats a pass over the probe keys for the given time and returns millions of lookups per second
+template<typename Pass>
+double run(Pass pass, int milliseconds) {
+    auto began = std::chrono::steady_clock::now();
+    auto deadline = began + std::chrono::milliseconds(milliseconds);
+    uint64_t passes = 0;
+    do {
+        sink = sink + pass();
+        ++passes;
+    } while (std::chrono::steady_clock::now() < deadline);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - began).count();
+    return static_cast<double>(passes) * PROBE_COUNT / seconds / 1e6;
+}
+
+}
+
+int main(int argc, char** argv) {
+    int milliseconds = argc > 1 ? std::atoi(argv[1]) : 500;
+    std::printf("%d ms per run, %zu keys per pass, Mlookups/s\n", milliseconds, PROBE_COUNT);
+    std::printf("%-8s %10s %12s %12s %9s\n", "mode", "entries", "find", "findBatch", "speedup");
+    
+    // Only even keys are inserted; every other probe sets the low bit and misses
+    DynamicArray<uint64_t> keys;
+    DynamicArray<uint64_t> probes(PROBE_COUNT);
+    DynamicArray<const uint64_t*> results(PROBE_COUNT, nullptr);
+    for (const Mode& mode : MODES) {
+        for (size_t table_size : TABLE_SIZES) {
+            HashTable<uint64_t, uint64_t, PowerOfTwoSizing> table(table_size * 2, mode.mode);
+            Random random(table_size);
+            keys.clear();
+            for (size_t i = 0; i < table_size; ++i) {
+                keys.push_back(random.next() & ~uint64_t(1));
+                table.insert(keys[i], i);
+            }
+            probes.clear();
+            for (size_t i = 0; i < PROBE_COUNT; ++i) {
+                uint64_t key = keys[random.next() % table_size];
+                probes.push_back(i & 1 ? key | 1 : key);
+            }
+            
+            const HashTable<uint64_t, uint64_t, PowerOfTwoSizing>& lookup = table;
+            double single = run([&]() {
+                uint64_t found = 0;
+                for (size_t i = 0; i < PROBE_COUNT; ++i) {
+                    found += lookup.find(probes[i]) != nullptr;
+                }
+                return found;
+            }, milliseconds);
+            double batched = run([&]() {
+                lookup.findBatch(probes.getData(), PROBE_COUNT, results.getData());
+                uint64_t found = 0;
+                for (size_t i = 0; i < PROBE_COUNT; ++i) {
+                    found += results[i] != nullptr;
+                }
+                return found;
+            }, milliseconds);
+            std::printf("%-8s %10zu %12.2f %12.2f %8.2fx\n", mode.name, table_size, single, batched,
+                        batched / single);
+        }
+    }
+    return 0;
+}
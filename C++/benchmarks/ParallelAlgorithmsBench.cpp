@@ -0,0 +1,115 @@
+//==================== PARALLEL ALGORITHMS BENCHMARK ====================
+// Wall time of ParallelAlgorithms sort, transform, reduce and inclusiveScan
+// over random 64-bit keys, on ThreadPools of 1 to 32 threads, next to the
+// sequential standard algorithm for the same work. Each cell is the best of
+// a few repetitions; the speedup column is sequential time over parallel time.
+//
+//     g++ -std=c++17 -O2 -pthread ParallelAlgorithmsBench.cpp -o bench
+//     ./bench [elements]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <thread>
+#include "../implementation/ParallelAlgorithms.cpp"
+
+namespace {
+
+const size_t THREAD_COUNTS[] = {1, 2, 4, 8, 16, 32};
+const int REPETITIONS = 5;
+
+// xorshift64*
+struct Random {
+    uint64_t state;
+    
+    explicit Random(uint64_t seed) : state(seed * 0x9E3779B97F4A7C15ULL | 1) {}
+    
+    uint64_t next() {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545F4914F6CDD1DULL;
+    }
+};
+
+// A few multiplies per element, so transform is not purely a memory copy
+uint64_t mix(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    return x ^ (x >> 33);
+}
+
+volatile uint64_t sink = 0;     // keeps the results observable
+
+// Best wall time in milliseconds of REPETITIONS calls; prepare runs untimed before each
+template<typename Prepare, typename Work>
+double bestOf(Prepare prepare, Work work) {
+    double best = 0;
+    for (int r = 0; r < REPETITIONS; ++r) {
+        prepare();
+        auto began = std::chrono::steady_clock::now();
+        work();
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - began).count();
+        if (r == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+void report(const char* algorithm, const char* pool, double milliseconds, double baseline) {
+    std::printf("%-10s %10s %12.2f %10.2fx\n", algorithm, pool, milliseconds, baseline / milliseconds);
+}
+
+}
+
+int main(int argc, char** argv) {
+    size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : size_t(1) << 23;
+    DynamicArray<uint64_t> keys(size);
+    Random random(1);
+    for (size_t i = 0; i < size; ++i) {
+        keys.push_back(random.next());
+    }
+    DynamicArray<uint64_t> work(keys);
+    const uint64_t* input = keys.getData();
+    uint64_t* output = work.getData();
+    auto restore = [&]() { std::copy(input, input + size, output); };
+    auto nothing = []() {};
+    
+    std::printf("%u hardware threads, %zu elements, best of %d\n", std::thread::hardware_concurrency(), size,
+                REPETITIONS);
+    std::printf("%-10s %10s %12s %11s\n", "algorithm", "threads", "ms", "speedup");
+    
+    double sort_baseline = bestOf(restore, [&]() { std::sort(output, output + size); });
+    double transform_baseline = bestOf(nothing, [&]() { std::transform(input, input + size, output, mix); });
+    double reduce_baseline = bestOf(nothing, [&]() { sink = std::accumulate(input, input + size, uint64_t(0)); });
+    double scan_baseline = bestOf(nothing, [&]() { std::partial_sum(input, input + size, output); });
+    report("sort", "sequential", sort_baseline, sort_baseline);
+    report("transform", "sequential", transform_baseline, transform_baseline);
+    report("reduce", "sequential", reduce_baseline, reduce_baseline);
+    report("scan", "sequential", scan_baseline, scan_baseline);
+    
+    for (size_t thread_count : THREAD_COUNTS) {
+        ThreadPool pool(thread_count);
+        char label[16];
+        std::snprintf(label, sizeof(label), "%zu", thread_count);
+        report("sort", label, bestOf(restore, [&]() {
+            ParallelAlgorithms::sort(output, size, std::less<uint64_t>(), pool);
+        }), sort_baseline);
+        report("transform", label, bestOf(nothing, [&]() {
+            ParallelAlgorithms::transform(input, size, output, mix, pool);
+        }), transform_baseline);
+        report("reduce", label, bestOf(nothing, [&]() {
+            sink = ParallelAlgorithms::reduce(input, size, uint64_t(0), std::plus<uint64_t>(), pool);
+        }), reduce_baseline);
+        report("scan", label, bestOf(nothing, [&]() {
+            ParallelAlgorithms::inclusiveScan(input, size, output, std::plus<uint64_t>(), pool);
+        }), scan_baseline);
+    }
+    return 0;
+}
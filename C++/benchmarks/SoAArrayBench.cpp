@@ -0,0 +1,116 @@
+//==================== STRUCTURE OF ARRAYS BENCHMARK ====================
+// Field scan over 64-byte particle records stored as a DynamicArray of
+// structs and as a SoAArray. The scan reads two of the eight fields
+// (position x and mass), so the struct layout streams every cache line of
+// the array while the column layout streams a quarter of the bytes. The
+// SoAArray is read both through its raw columns and through the proxies.
+//
+//     g++ -std=c++17 -O2 SoAArrayBench.cpp -o bench
+//     ./bench [milliseconds per run]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include "../implementation/SoAArray.cpp"
+
+namespace {
+
+const size_t ELEMENT_COUNTS[] = {1 << 10, 1 << 14, 1 << 18, 1 << 22};
+
+struct Particle {
+    double x, y, z;
+    double vx, vy, vz;
+    double mass;
+    double charge;
+};
+
+using Particles = SoAArray<double, double, double, double, double, double, double, double>;
+
+// xorshift64*, so both layouts are filled with the same values
+struct Random {
+    uint64_t state;
+    
+    explicit Random(uint64_t seed) : state(seed * 0x9E3779B97F4A7C15ULL | 1) {}
+    
+    double next() {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return static_cast<double>((state * 0x2545F4914F6CDD1DULL) >> 11) * 0x1.0p-53;
+    }
+};
+
+double scanStructs(const DynamicArray<Particle>& particles) {
+    double moment = 0;
+    for (size_t i = 0; i < particles.getSize(); ++i) {
+        moment += particles[i].x * particles[i].mass;
+    }
+    return moment;
+}
+
+double scanColumns(const Particles& particles) {
+    const double* x = particles.column<0>();
+    const double* mass = particles.column<6>();
+    double moment = 0;
+    for (size_t i = 0; i < particles.getSize(); ++i) {
+        moment += x[i] * mass[i];
+    }
+    return moment;
+}
+
+double scanProxies(const Particles& particles) {
+    double moment = 0;
+    for (size_t i = 0; i < particles.getSize(); ++i) {
+        moment += particles[i].get<0>() * particles[i].get<6>();
+    }
+    return moment;
+}
+
+volatile double sink = 0;   // keeps the scans observable
+
+// Repeats the scan for the given time and returns nanoseconds per element
+template<typename Scan>
+double run(Scan scan, size_t element_count, int milliseconds) {
+    auto began = std::chrono::steady_clock::now();
+    auto deadline = began + std::chrono::milliseconds(milliseconds);
+    uint64_t passes = 0;
+    do {
+        sink += scan();
+        ++passes;
+    } while (std::chrono::steady_clock::now() < deadline);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - began).count();
+    return seconds * 1e9 / (static_cast<double>(passes) * element_count);
+}
+
+}
+
+int main(int argc, char** argv) {
+    int milliseconds = argc > 1 ? std::atoi(argv[1]) : 500;
+    std::printf("%d ms per run, %zu-byte records, ns per element\n", milliseconds, sizeof(Particle));
+    std::printf("%10s %12s %12s %12s\n", "elements", "structs", "columns", "proxies");
+    for (size_t element_count : ELEMENT_COUNTS) {
+        DynamicArray<Particle> structs(element_count);
+        Particles columns(element_count);
+        Random random(element_count);
+        for (size_t i = 0; i < element_count; ++i) {
+            Particle p;
+            p.x = random.next();
+            p.y = random.next();
+            p.z = random.next();
+            p.vx = random.next();
+            p.vy = random.next();
+            p.vz = random.next();
+            p.mass = random.next();
+            p.charge = random.next();
+            structs.push_back(p);
+            columns.push_back(p.x, p.y, p.z, p.vx, p.vy, p.vz, p.mass, p.charge);
+        }
+        
+        double by_struct = run([&]() { return scanStructs(structs); }, element_count, milliseconds);
+        double by_column = run([&]() { return scanColumns(columns); }, element_count, milliseconds);
+        double by_proxy = run([&]() { return scanProxies(columns); }, element_count, milliseconds);
+        std::printf("%10zu %12.3f %12.3f %12.3f\n", element_count, by_struct, by_column, by_proxy);
+    }
+    return 0;
+}
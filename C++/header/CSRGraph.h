@@ -0,0 +1,100 @@
+//==================== CSR GRAPH ====================
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "vectors.h"
+#include "HashTable.h"
+#include "ThreadPool.h"
+
+template<typename T>
+class Graph;
+
+// Immutable compressed sparse row snapshot of a Graph, made by Graph::freeze().
+// Vertices get dense uint32_t ids in the Graph's vertex order. The out-edges of
+// vertex v are targets[offsets[v]] up to targets[offsets[v + 1]], sorted by id,
+// with their weights in the parallel weights array, so a traversal reads
+// contiguous memory instead of chasing list nodes. Directed graphs also keep
+// the transposed arrays for in-edges; undirected ones store each edge both ways.
+template<typename T>
+class CSRGraph {
+private:
+    DynamicArray<T> vertices;
+    DynamicArray<size_t> offsets;           // vertex count + 1 entries
+    DynamicArray<uint32_t> targets;
+    DynamicArray<double> weights;
+    DynamicArray<size_t> in_offsets;        // empty unless directed
+    DynamicArray<uint32_t> in_sources;
+    DynamicArray<double> in_weights;
+    HashTable<T, uint32_t, PowerOfTwoSizing> ids;
+    size_t edge_count;
+    bool is_directed;
+    bool is_weighted;
+    
+    // Direction-optimizing BFS goes bottom-up once the frontier's edges exceed
+    // 1/BFS_ALPHA of the unexplored ones, and back to top-down when a shrinking
+    // frontier falls below 1/BFS_BETA of the vertices (Beamer et al.)
+    static constexpr size_t BFS_ALPHA = 14;
+    static constexpr size_t BFS_BETA = 24;
+    static constexpr size_t BFS_GRAIN = 1024;      // frontier entries or vertices per task
+    
+    friend class Graph<T>;
+    
+    // Private helper functions to implement
+    CSRGraph(bool directed, bool weighted);
+    void buildTranspose();
+    uint32_t requireId(const T& vertex) const;
+    size_t reachable(uint32_t source, uint32_t stop, bool both_directions, bool* visited, uint32_t* queue) const;
+    void shortestPaths(uint32_t source, uint32_t stop, double* distances, uint32_t* previous) const;
+    static size_t bfsTaskCount(size_t work, const ThreadPool& pool);
+    size_t topDownStep(const DynamicArray<uint32_t>& frontier, DynamicArray<uint32_t>& next,
+                       std::atomic<uint64_t>* visited, uint32_t* distances, uint32_t* parents, ThreadPool& pool) const;
+    size_t bottomUpStep(const DynamicArray<uint64_t>& frontier, DynamicArray<uint64_t>& next,
+                        std::atomic<uint64_t>* visited, uint32_t* distances, uint32_t* parents,
+                        size_t& frontier_edges, ThreadPool& pool) const;
+    
+public:
+    static constexpr uint32_t NO_VERTEX = UINT32_MAX;
+    
+    CSRGraph();
+    
+    // Vertices and ids
+    size_t getVertexCount() const;
+    size_t getEdgeCount() const;
+    bool isDirected() const;
+    bool isWeighted() const;
+    bool hasVertex(const T& vertex) const;
+    uint32_t getId(const T& vertex) const;     // throws std::out_of_range for unknown vertices
+    const T& getVertex(uint32_t id) const;
+    
+    // Adjacency as pointers into the contiguous arrays; ids are not range checked
+    const uint32_t* getNeighbors(uint32_t id, size_t& neighbor_count) const;
+    const double* getWeights(uint32_t id, size_t& weight_count) const;
+    const uint32_t* getInNeighbors(uint32_t id, size_t& neighbor_count) const;
+    const double* getInWeights(uint32_t id, size_t& weight_count) const;
+    size_t getOutDegree(uint32_t id) const;
+    size_t getInDegree(uint32_t id) const;
+    bool hasEdge(const T& source, const T& destination) const;
+    double getEdgeWeight(const T& source, const T& destination) const;
+    
+    // Algorithms with the same results as the Graph versions; neighbors are
+    // visited in id order. Arrays come back in id order, owned by the caller.
+    void breadthFirstSearch(const T& start_vertex, void (*visit)(const T&)) const;
+    void depthFirstSearch(const T& start_vertex, void (*visit)(const T&)) const;
+    bool hasPath(const T& source, const T& destination) const;
+    void dijkstra(const T& source, double*& distances, T*& predecessors) const;
+    double shortestPathDistance(const T& source, const T& destination) const;
+    size_t countConnectedComponents() const;   // weakly connected for directed graphs
+    bool isConnected() const;
+    T* topologicalSort(size_t& sorted_count) const;
+    
+    // Direction-optimizing BFS on a thread pool. Gives hop counts and BFS tree
+    // parents by id, NO_VERTEX for unreached vertices; the start is its own
+    // parent. A vertex may get any of its parents one level up.
+    void parallelBreadthFirstSearch(const T& start_vertex, uint32_t*& distances, uint32_t*& parents,
+                                    ThreadPool& pool = ThreadPool::shared()) const;
+};
+
+#endif
@@ -0,0 +1,102 @@
+//==================== CONCURRENT HASH TABLE ====================
+#ifndef CONCURRENT_HASH_TABLE_H
+#define CONCURRENT_HASH_TABLE_H
+
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+#include "HashTable.h"
+
+// Key space split across a power-of-two number of HashTable shards.
+// Writers serialize per shard behind a mutex and a sequence counter.
+// Lookups are optimistic seqlock reads: they never take the mutex or write
+// shared state, they probe the shard and retry if a writer changed it in the
+// meantime. A reader only waits while a writer is active on its own shard.
+//
+// Memory a reader may be probing is never freed under it. Each thread that
+// reads announces the shard it is in through its own cache-line slot, and a
+// write that can replace the bucket arrays first waits for those slots to
+// leave the shard. Keys and values that are not trivially copyable can free
+// memory on any write, so for them every write waits out readers instead.
+template<typename Key, typename Value, typename Sizing = PrimeSizing,
+         typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class ConcurrentHashTable {
+private:
+    // Torn reads are discarded by validation, but only plain bytes can be torn safely
+    static constexpr bool OPTIMISTIC_READS = std::is_trivially_copyable<Key>::value &&
+                                             std::is_trivially_copyable<Value>::value;
+    
+    struct alignas(64) Shard {
+        HashTable<Key, Value, Sizing, Hash, KeyEqual> table;
+        std::mutex write_lock;
+        mutable std::atomic<uint64_t> sequence;    // odd while a writer owns the shard
+        
+        // Shard constructor to implement
+        Shard();
+    };
+    
+    // One per reading thread, never freed: a thread that exits hands it to the next
+    struct alignas(64) ReaderSlot {
+        std::atomic<const Shard*> shard;           // shard being probed, nullptr when idle
+        std::atomic<bool> in_use;
+        ReaderSlot* next;
+    };
+    
+    static std::atomic<ReaderSlot*> reader_slots;
+    
+    // Holds a shard's write lock and keeps its sequence odd
+    class WriteGuard {
+    private:
+        Shard& shard;
+        bool drained;
+    public:
+        WriteGuard(Shard& s);
+        ~WriteGuard();
+        WriteGuard(const WriteGuard&) = delete;
+        WriteGuard& operator=(const WriteGuard&) = delete;
+        void waitForReaders();      // call before anything that may free memory readers can reach
+    };
+    
+    Shard* shards;
+    size_t shard_count;
+    size_t shard_bits;
+    
+    // Private helper functions to implement
+    size_t hash(const Key& key) const;
+    Shard& shardFor(const Key& key);
+    const Shard& shardFor(const Key& key) const;
+    template<typename Function>
+    auto readShard(const Shard& shard, Function&& function) const -> decltype(function(shard.table));
+    static ReaderSlot& readerSlot();
+    static ReaderSlot* claimReaderSlot();
+    void destroyShards();
+    
+public:
+    // Constructors and Destructor
+    ConcurrentHashTable(size_t shard_count = 64, size_t initial_capacity = 17, ProbingMode mode = ProbingMode::Linear);
+    ConcurrentHashTable(const ConcurrentHashTable& other) = delete;
+    ConcurrentHashTable& operator=(const ConcurrentHashTable& other) = delete;
+    ~ConcurrentHashTable();
+    
+    // Modifiers
+    void insert(const Key& key, const Value& value);
+    void insert(Key&& key, Value&& value);
+    template<typename... Args>
+    void emplace(const Key& key, Args&&... args);
+    template<typename Function>
+    bool update(const Key& key, Function&& function);
+    bool remove(const Key& key);
+    void clear();
+    
+    // Lookup operations (optimistic, results are copied out)
+    bool find(const Key& key, Value& result) const;
+    bool contains(const Key& key) const;
+    
+    // Capacity
+    size_t getSize() const;
+    bool empty() const;
+    size_t getShardCount() const;
+    void reserve(size_t min_capacity);
+};
+
+#endif
@@ -0,0 +1,114 @@
+//==================== DIJKSTRA ENGINE ====================
+#ifndef DIJKSTRA_ENGINE_H
+#define DIJKSTRA_ENGINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "vectors.h"
+#include "CSRGraph.h"
+#include "IndexedHeap.h"
+
+// Plain Dijkstra's heuristic. A* takes a functor with the same call that
+// never overestimates the distance left from vertex to destination.
+struct ZeroHeuristic {
+    template<typename T>
+    double operator()(const T& vertex, const T& destination) const;
+};
+
+// Reusable Dijkstra searches over a CSRGraph, meant for many point-to-point
+// queries against one snapshot. Heap is BinaryHeap, PairingHeap or RadixHeap
+// (see IndexedHeap.h); RadixHeap needs whole-number weights. Scratch arrays
+// are allocated once and stamped per query, so a search that stops at its
+// target costs what it settled, not the vertex count. The snapshot must
+// outlive the engine, and one engine serves one thread at a time.
+//
+// A Heuristic other than ZeroHeuristic turns searches that have a target into
+// A*, which settles vertices in order of distance plus estimate. An estimate
+// that is admissible but not consistent can reopen settled vertices; the
+// target's distance and path stay exact either way.
+template<typename T, typename Heap = BinaryHeap, typename Heuristic = ZeroHeuristic>
+class DijkstraEngine {
+private:
+    static_assert(!Heap::integer_keys || std::is_same<Heuristic, ZeroHeuristic>::value,
+                  "A* keys are neither whole nor monotone, so RadixHeap cannot order them");
+    
+    const CSRGraph<T>* graph;
+    Heuristic heuristic;
+    Heap heap;
+    DynamicArray<double> distances;     // valid when the vertex's stamp is current
+    DynamicArray<uint32_t> previous;
+    DynamicArray<uint32_t> stamps;      // 2 * query once reached, 2 * query + 1 once settled
+    uint32_t query;
+    size_t settled_count;
+    
+    template<typename, typename>
+    friend class BidirectionalDijkstraEngine;
+    
+    // Private helper functions to implement
+    bool isReached(uint32_t id) const;
+    void beginQuery();
+    static void checkWeights(const CSRGraph<T>& snapshot, bool whole_numbers);
+    
+public:
+    // Throws std::invalid_argument on weights the search cannot use
+    explicit DijkstraEngine(const CSRGraph<T>& snapshot, Heuristic heuristic = Heuristic());
+    
+    // Settles vertices from source until target is settled, or all of them
+    // when target is NO_VERTEX. The results below describe the last search.
+    void search(uint32_t source_id, uint32_t target_id = CSRGraph<T>::NO_VERTEX);
+    double getDistance(uint32_t id) const;      // exact once settled, infinity if never reached
+    uint32_t getPredecessor(uint32_t id) const; // NO_VERTEX for the source and unreached vertices
+    bool isSettled(uint32_t id) const;
+    size_t getSettledCount() const;             // settles of the last search, reopened ones again
+    void getPath(uint32_t target_id, DynamicArray<uint32_t>& path) const;  // source first, empty if unreached
+    
+    // Same results as the CSRGraph and Graph versions
+    double shortestPathDistance(const T& source_vertex, const T& destination);
+    T* shortestPath(const T& source_vertex, const T& destination, size_t& path_length);
+    void dijkstra(const T& source_vertex, double*& distances_out, T*& predecessors);
+};
+
+// Point-to-point Dijkstra grown from both ends at once: forward over
+// out-edges from the source, backward over in-edges from the target, always
+// extending the side with the smaller queue. It stops once the two search
+// radii add up to the best meeting found, usually after settling far fewer
+// vertices than a one-sided search. Same scratch reuse and heaps as above.
+template<typename T, typename Heap = BinaryHeap>
+class BidirectionalDijkstraEngine {
+private:
+    struct Side {
+        Heap heap;
+        DynamicArray<double> distances;
+        DynamicArray<uint32_t> previous;    // toward the source going forward, toward the target going back
+        DynamicArray<uint32_t> stamps;
+        double radius;                      // distance of the last vertex settled
+    };
+    
+    const CSRGraph<T>* graph;
+    Side forward;
+    Side backward;
+    uint32_t query;
+    uint32_t meeting;                       // vertex on the best path found, NO_VERTEX if none
+    double best;
+    size_t settled_count;
+    
+    // Private helper functions to implement
+    void beginQuery();
+    void start(Side& side, uint32_t vertex);
+    void settleNext(Side& side, const Side& other, bool reverse);
+    
+public:
+    explicit BidirectionalDijkstraEngine(const CSRGraph<T>& snapshot);
+    
+    // Results below describe the last search
+    void search(uint32_t source_id, uint32_t target_id);
+    double getDistance() const;                 // infinity if the target is unreachable
+    size_t getSettledCount() const;             // both sides together
+    void getPath(DynamicArray<uint32_t>& path) const;   // source first, empty if unreachable
+    
+    double shortestPathDistance(const T& source_vertex, const T& destination);
+    T* shortestPath(const T& source_vertex, const T& destination, size_t& path_length);
+};
+
+#endif
@@ -2,6 +2,17 @@
 #ifndef GRAPH_H
 #define GRAPH_H
 
+#include <cstddef>
+#include <cstdint>
+#include "vectors.h"
+#include "HashTable.h"
+#include "CSRGraph.h"
+
+// Adjacency list graph. Each vertex keeps its outgoing edges in a singly
+// linked list in insertion order; undirected edges are stored in both lists
+// and counted once. Vertices are located through a hash index, so T needs
+// std::hash and ==. Arrays returned by pointer are allocated with new[] and
+// owned by the caller; T* results are nullptr when they would be empty.
 template<typename T>
 class Graph {
 private:
@@ -23,6 +34,8 @@ private:
         ~Edge();
     };
     
+    // Graph allocates and frees the edge lists; copying a Vertex leaves the
+    // copy without edges and moving it hands the list over
     struct Vertex {
         T data;
         Edge* edge_list;
@@ -43,12 +56,16 @@ private:
         ~Vertex();
     };
     
+    static constexpr size_t DEFAULT_CAPACITY = 16;
+    static constexpr size_t NO_INDEX = static_cast<size_t>(-1);
+    
     Vertex* vertices;
     size_t vertex_count;
     size_t vertex_capacity;
     size_t edge_count;
     bool is_directed;
     bool is_weighted;
+    HashTable<T, size_t, PowerOfTwoSizing> vertex_index;   // vertex value to its slot in vertices
     
     // Private helper functions to implement
     void reallocateVertices(size_t new_capacity);
@@ -71,19 +88,36 @@ private:
     void initializeVertices();
     void destroyVertices();
     void resetVertexStates();
+    size_t requireVertexIndex(const T& vertex) const;
+    size_t countEdges(const Edge* edge_list) const;
+    T* copyVertexData(const size_t* indices, size_t count) const;
+    T* tracePath(const size_t* previous, size_t target, size_t& path_length) const;
+    T* predecessorPath(size_t target, size_t& path_length) const;
+    
+    // Edge targets as vertex indices in CSR form; symmetric adds the reverse of directed edges
+    void indexAdjacency(DynamicArray<size_t>& offsets, DynamicArray<size_t>& neighbors, bool symmetric) const;
+    size_t componentLabels(size_t* labels) const;
+    T** groupComponents(const size_t* labels, size_t group_count, size_t*& group_sizes) const;
+    static size_t findSet(size_t* parents, size_t element);
     
     // Algorithm helpers to implement
     void dfsHelper(const T& vertex, void (*visit)(const T&));
     void dfsHelperRecursive(size_t vertex_index, void (*visit)(const T&), int& time);
     void bfsHelper(const T& vertex, void (*visit)(const T&));
     bool hasPathHelper(const T& source, const T& destination);
-    void dijkstraHelper(const T& source);
-    void bellmanFordHelper(const T& source);
-    void floydWarshallHelper();
-    bool topologicalSortHelper(T* result);
-    void stronglyConnectedComponentsHelper();
-    double primMSTHelper();
-    double kruskalMSTHelper();
+    void dijkstraHelper(const T& source, size_t stop);
+    template<typename Heuristic>
+    void aStarHelper(size_t start, size_t target, Heuristic& heuristic);
+    bool bellmanFordHelper(const T& source);
+    void floydWarshallHelper(double* distances, size_t* predecessors) const;
+    bool topologicalSortHelper(size_t* order) const;
+    size_t stronglyConnectedComponentsHelper(size_t* labels) const;
+    bool twoColorHelper(size_t* sides) const;
+    bool colorableHelper(const DynamicArray<size_t>& offsets, const DynamicArray<size_t>& neighbors,
+                         const size_t* order, int color_count) const;
+    double primMSTHelper(Edge** mst_edges, size_t& mst_edge_count) const;
+    double kruskalMSTHelper(Edge** mst_edges, size_t& mst_edge_count) const;
+    static bool isPlanarBlock(size_t vertex_total, const DynamicArray<size_t>& block_edges);
     
 public:
     // Constructors and Destructor
@@ -126,6 +160,9 @@ public:
     void clear();
     void swap(Graph& other);
     
+    // Read-only CSR snapshot for analytics; later changes to the graph do not affect it
+    CSRGraph<T> freeze() const;
+    
     // Neighbor operations
     T* getNeighbors(const T& vertex, size_t& neighbor_count) const;
     T* getInNeighbors(const T& vertex, size_t& neighbor_count) const;
@@ -136,15 +173,22 @@ public:
     void breadthFirstSearch(const T& start_vertex, void (*visit)(const T&));
     void depthFirstTraversal(void (*visit)(const T&));
     void breadthFirstTraversal(void (*visit)(const T&));
+    // Hop counts and BFS tree predecessors in the form dijkstra gives; runs
+    // CSRGraph::parallelBreadthFirstSearch on a fresh freeze()
+    void parallelBreadthFirstSearch(const T& start_vertex, double*& distances, T*& predecessors) const;
     
     // Graph algorithms - Path finding
     bool hasPath(const T& source, const T& destination);
     T* shortestPath(const T& source, const T& destination, size_t& path_length);
+    // A*: heuristic(vertex, destination) must never overestimate the distance left
+    template<typename Heuristic>
+    T* shortestPath(const T& source, const T& destination, size_t& path_length, Heuristic heuristic);
     double shortestPathDistance(const T& source, const T& destination);
     T* longestPath(const T& source, const T& destination, size_t& path_length);
     T** allShortestPaths(double**& distances);
     
-    // Graph algorithms - Shortest path algorithms
+    // Graph algorithms - Shortest path algorithms; for many queries on one
+    // graph, run a DijkstraEngine on freeze() instead
     void dijkstra(const T& source, double*& distances, T*& predecessors);
     bool bellmanFord(const T& source, double*& distances, T*& predecessors);
     void floydWarshall(double**& distances, T**& predecessors);
@@ -165,11 +209,12 @@ public:
     T* topologicalSort(size_t& sorted_count);
     T** allTopologicalSorts(size_t& sort_count);
     
-    // Graph algorithms - Minimum spanning tree
+    // Graph algorithms - Minimum spanning tree (undirected graphs; a forest when disconnected)
     double minimumSpanningTreePrim(Edge**& mst_edges, size_t& edge_count);
     double minimumSpanningTreeKruskal(Edge**& mst_edges, size_t& edge_count);
     
-    // Graph algorithms - Special properties
+    // Graph algorithms - Special properties. chromaticNumber is exact and exponential
+    // in the worst case (-1 with a self-loop); graphColoring is greedy by degree.
     bool isBipartite();
     T** getBipartitePartitions(size_t*& partition_sizes);
     bool isPlanar();
@@ -182,7 +227,7 @@ public:
         Vertex* vertices;
         size_t vertex_count;
         size_t current_index;
-        
+    
     public:
         VertexIterator();
         VertexIterator(Vertex* v, size_t count, size_t index);
@@ -207,7 +252,7 @@ public:
         Edge* current_edge;
         
         void findNextEdge();
-        
+    
     public:
         EdgeIterator();
         EdgeIterator(Vertex* v, size_t count, size_t vertex_idx, Edge* edge);
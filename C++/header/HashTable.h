@@ -2,14 +2,74 @@
 #ifndef HASH_TABLE_H
 #define HASH_TABLE_H
 
-template<typename Key, typename Value>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HASH_TABLE_USE_SSE2 1
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#define HASH_TABLE_USE_MMAP 1
+#endif
+
+// Collision resolution strategy, fixed when the table is constructed
+enum class ProbingMode {
+    Linear,
+    Quadratic,
+    DoubleHash,
+    Group,      // compares 16 control bytes per step before touching any key
+    RobinHood,  // linear probing ordered by probe distance, no tombstones
+    Cuckoo      // two 4-slot buckets per key, a lookup reads at most 8 slots
+};
+
+// Bucket sizing policies, chosen at compile time: how a capacity is rounded
+// and how a hash value is reduced to a slot index
+struct PrimeSizing {
+    static constexpr bool power_of_two = false;
+    static size_t roundCapacity(size_t n);
+    static size_t reduce(size_t value, size_t bucket_count);
+    static size_t nextPrime(size_t n);
+    static bool isPrime(size_t n);
+};
+
+struct PowerOfTwoSizing {
+    static constexpr bool power_of_two = true;
+    static size_t roundCapacity(size_t n);
+    static size_t reduce(size_t value, size_t bucket_count);   // mask, no division
+};
+
+// Functors that declare is_transparent accept any type comparable with the key
+template<typename T, typename = void>
+struct IsTransparent : std::false_type {};
+
+template<typename T>
+struct IsTransparent<T, std::void_t<typename T::is_transparent>> : std::true_type {};
+
+// Hashes std::string, std::string_view and const char* to the same value;
+// pair with std::equal_to<> to look up std::string keys without a temporary
+struct TransparentStringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view value) const;
+};
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+class ConcurrentHashTable;
+
+template<typename Key, typename Value, typename Sizing = PrimeSizing,
+         typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
 class HashTable {
 private:
+    template<typename, typename, typename, typename, typename>
+    friend class ConcurrentHashTable;
+    
     struct KeyValuePair {
         Key key;
         Value value;
-        bool is_deleted;
-        bool is_occupied;
         
         // KeyValuePair constructors to implement
         KeyValuePair();
@@ -22,38 +82,138 @@ private:
         ~KeyValuePair();
     };
     
+    // Control byte states: full slots hold a 7-bit hash fragment (0x00-0x7F)
+    static constexpr uint8_t CONTROL_EMPTY = 0x80;
+    static constexpr uint8_t CONTROL_DELETED = 0xFE;
+    static constexpr size_t GROUP_WIDTH = 16;
+    static constexpr double MAX_LOAD_FACTOR = 0.75;
+    static constexpr size_t BATCH_SIZE = 16;
+    static constexpr size_t CUCKOO_WAYS = 4;
+    static constexpr size_t CUCKOO_MAX_KICKS = 128;
+    
+    // On-disk layout written by saveToFile: this header, then the bucket,
+    // control and distance arrays at the recorded offsets
+    struct MappedHeader {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t probing_mode;
+        uint64_t bucket_count;
+        uint64_t size;
+        uint64_t deleted_count;
+        uint64_t pair_size;
+        uint64_t key_size;
+        uint64_t value_size;
+        uint64_t power_of_two;
+        uint64_t buckets_offset;
+        uint64_t control_offset;
+        uint64_t distances_offset;      // 0 unless RobinHood
+        uint64_t file_size;
+    };
+    static constexpr uint64_t MAPPED_MAGIC = 0x50414D4854534148ULL;    // "HASHTMAP"
+    static constexpr uint32_t MAPPED_VERSION = 1;
+    static constexpr size_t MAPPED_ALIGNMENT = 64;
+    
     KeyValuePair* buckets;
+    uint8_t* control;           // bucket_count + GROUP_WIDTH - 1 bytes, tail mirrors the head
+    uint32_t* distances;        // probe distance per slot, RobinHood mode only
     size_t bucket_count;
     size_t size;
     size_t deleted_count;
+    ProbingMode probing_mode;
+    
+    // Heterogeneous overloads exist only when Hash and KeyEqual are both transparent
+    template<typename K, typename Result>
+    using IfTransparent = typename std::enable_if<IsTransparent<Hash>::value && IsTransparent<KeyEqual>::value &&
+                                                  !std::is_same<K, Key>::value, Result>::type;
+                                                  
+    // Incremental resize state: the previous table drains into this one
+    HashTable* draining;
+    size_t migrate_index;
+    size_t migration_step;      // least old slots moved per modifying call, 0 resizes in one pass
+    uint8_t* next_control;      // control bytes for the next doubling, filled a chunk per call
+    size_t next_count;          // bucket count next_control is being prepared for
+    size_t next_filled;         // bytes of next_control already set to CONTROL_EMPTY
+    
+    // Read-only file mapping backing the arrays, nullptr when they are heap-owned
+    void* mapped_region;
+    size_t mapped_length;
     
     // Hash functions to implement
-    size_t hash(const Key& key) const;
+    template<typename K>
+    size_t hash(const K& key) const;
     size_t hash(const Key& key, size_t table_size) const;
-    size_t doubleHash(const Key& key, size_t attempt) const;
+    size_t doubleHash(size_t hash_value, size_t attempt) const;
+    uint8_t fragment(size_t hash_value) const;
     
     // Probing functions to implement
     size_t linearProbe(size_t hash_value, size_t attempt) const;
     size_t quadraticProbe(size_t hash_value, size_t attempt) const;
-    size_t doubleHashProbe(size_t hash_value, size_t attempt, const Key& key) const;
+    size_t doubleHashProbe(size_t home, size_t attempt, size_t hash_value) const;
+    size_t probe(size_t home, size_t attempt, size_t hash_value) const;
+    
+    // Control byte helpers to implement
+    static uint32_t matchGroup(const uint8_t* group, uint8_t value);
+    static uint32_t matchEmptyOrDeleted(const uint8_t* group);
+    static size_t lowestBit(uint32_t mask);
+    static void prefetch(const void* address);
+    bool isFull(size_t index) const;
+    void setControl(size_t index, uint8_t value);
+    size_t wrapIndex(size_t index) const;
+    size_t nextGroup(size_t position) const;
     
     // Private helper functions to implement
     void rehash();
     void resize(size_t new_capacity);
-    size_t findSlot(const Key& key) const;
+    template<typename K>
+    size_t findSlot(const K& key) const;
+    template<typename K>
+    size_t findSlot(const K& key, size_t hash_value) const;
     size_t findInsertSlot(const Key& key) const;
+    template<typename K>
+    size_t findSlotGroup(const K& key, size_t hash_value) const;
+    size_t findInsertSlotGroup(size_t hash_value) const;
+    template<typename K>
+    size_t findSlotRobinHood(const K& key, size_t hash_value) const;
+    size_t placeRobinHood(KeyValuePair&& pair);
+    void eraseRobinHood(size_t slot);
+    size_t probeDistance(size_t slot) const;
+    size_t cuckooBucket(size_t hash_value, size_t choice) const;
+    size_t cuckooFreeSlot(size_t bucket) const;
+    template<typename K>
+    size_t findSlotCuckoo(const K& key, size_t hash_value) const;
+    size_t placeCuckoo(KeyValuePair&& pair);
+    size_t placeNew(KeyValuePair&& pair);
     bool needsResize() const;
+    bool insertMayResize(const Key& key) const;
     double loadFactor() const;
-    size_t nextPrime(size_t n) const;
-    bool isPrime(size_t n) const;
     void copyFrom(const HashTable& other);
     void moveFrom(HashTable&& other);
     void initializeBuckets();
     void destroyBuckets();
+    static KeyValuePair* allocateSlots(size_t count);
+    static void deallocateSlots(KeyValuePair* slots, size_t count);
+    void ensureWritable() const;
+    static MappedHeader mappedLayout(size_t bucket_count, ProbingMode mode);
+    
+    // Lookup helpers shared by the Key and heterogeneous overloads
+    template<typename K>
+    const Value* findValue(const K& key) const;
+    template<typename K>
+    Value& findOrInsert(const K& key);
+    template<typename K>
+    bool removeKey(const K& key);
+    
+    // Incremental resize helpers to implement
+    void beginMigration(size_t new_capacity);
+    void migrateStep();
+    void completeMigration();
+    void retireSlot(size_t slot);
+    void prepareControl();
+    void releaseDrained(size_t from, size_t to);
     
 public:
     // Constructors and Destructor
-    HashTable(size_t initial_capacity = 17);
+    HashTable(size_t initial_capacity = 17, ProbingMode mode = ProbingMode::Linear);
     HashTable(const HashTable& other);
     HashTable(HashTable&& other) noexcept;
     ~HashTable();
@@ -86,29 +246,73 @@ public:
     Value* find(const Key& key);
     const Value* find(const Key& key) const;
     
+    // Heterogeneous lookup, e.g. std::string_view against std::string keys;
+    // a Key is only constructed when operator[] has to insert
+    template<typename K>
+    IfTransparent<K, Value&> operator[](const K& key);
+    template<typename K>
+    IfTransparent<K, Value&> at(const K& key);
+    template<typename K>
+    IfTransparent<K, const Value&> at(const K& key) const;
+    template<typename K>
+    IfTransparent<K, bool> remove(const K& key);
+    template<typename K>
+    IfTransparent<K, bool> contains(const K& key) const;
+    template<typename K>
+    IfTransparent<K, Value*> find(const K& key);
+    template<typename K>
+    IfTransparent<K, const Value*> find(const K& key) const;
+    
+    // Bulk operations: insertBulk sizes the table once for forward ranges,
+    // findBatch hashes and prefetches a batch of home slots before probing
+    template<typename InputIterator>
+    void insertBulk(InputIterator first, InputIterator last);
+    void findBatch(const Key* keys, size_t count, Value** results);
+    void findBatch(const Key* keys, size_t count, const Value** results) const;
+    
+    // Persistence for trivially copyable keys and values: mapFile opens a saved
+    // table read-only and probes the file pages in place, without rebuilding it.
+    // Hash must give the same values in the reading process as in the writer.
+    void saveToFile(const std::string& path) const;
+    static HashTable mapFile(const std::string& path);
+    bool isMapped() const;
+    
     // Capacity
     size_t getSize() const;
     bool empty() const;
     size_t getBucketCount() const;
     double getLoadFactor() const;
     size_t getCollisionCount() const;
+    size_t getMaxProbeDistance() const;
+    double getMeanProbeDistance() const;
+    ProbingMode getProbingMode() const;
     
     // Hash table operations
     void rehashToSize(size_t new_size);
     void reserve(size_t min_capacity);
+    void setIncrementalResize(size_t buckets_per_step);
+    bool isResizing() const;
     
     // Iterator class
     class Iterator {
     private:
+        KeyValuePair* old_buckets;
+        const uint8_t* old_control;
+        size_t old_bucket_count;
         KeyValuePair* buckets;
+        const uint8_t* control;
         size_t bucket_count;
-        size_t current_index;
+        size_t current_index;       // old slots first, then slots of the current table
         
         void findNextValid();
+        bool isValid() const;
+        KeyValuePair* current() const;
         
     public:
         Iterator();
-        Iterator(KeyValuePair* buckets, size_t bucket_count, size_t start_index);
+        Iterator(KeyValuePair* buckets, const uint8_t* control, size_t bucket_count, size_t start_index);
+        Iterator(KeyValuePair* old_buckets, const uint8_t* old_control, size_t old_bucket_count,
+                 KeyValuePair* buckets, const uint8_t* control, size_t bucket_count, size_t start_index);
         Iterator(const Iterator& other);
         Iterator& operator=(const Iterator& other);
         KeyValuePair& operator*();
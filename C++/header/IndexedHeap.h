@@ -0,0 +1,113 @@
+//==================== INDEXED HEAPS ====================
+#ifndef INDEXED_HEAP_H
+#define INDEXED_HEAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include "vectors.h"
+
+// Min-priority queues over vertex ids 0 .. n - 1, the heap policies of
+// DijkstraEngine. Each one keeps its arrays between searches: reset(n) only
+// grows them and clear() costs no more than the pushes it undoes, so a query
+// pays for what it touches rather than for the vertex count. push inserts a
+// vertex or lowers its key; pop removes a vertex with the smallest key.
+// integer_keys heaps take whole-number keys that never drop below the last
+// popped one, and may hand a vertex back again after its key was lowered.
+class BinaryHeap {
+private:
+    DynamicArray<uint32_t> heap;        // vertex ids in heap order
+    DynamicArray<double> keys;          // by heap slot
+    DynamicArray<uint32_t> positions;   // heap slot of each vertex, valid when its stamp is current
+    DynamicArray<uint32_t> stamps;
+    uint32_t generation;
+    
+    // Private helper functions to implement
+    void place(size_t slot, uint32_t vertex, double key);
+    void siftUp(size_t slot);
+    void siftDown(size_t slot);
+    
+public:
+    static constexpr bool integer_keys = false;
+    
+    BinaryHeap();
+    
+    void reset(size_t vertex_count);
+    void clear();
+    bool empty() const;
+    size_t getSize() const;
+    void push(uint32_t vertex, double key);     // decrease-key when the vertex is queued
+    uint32_t pop();
+};
+
+// Pairing heap threaded through per-vertex links, so decrease-key cuts the
+// vertex's subtree and melds it with the root in O(1)
+class PairingHeap {
+private:
+    static constexpr uint32_t NONE = UINT32_MAX;
+    
+    // One record per vertex, so following a link touches a single cache line
+    struct Node {
+        double key;
+        uint32_t child;     // leftmost child
+        uint32_t sibling;   // right sibling
+        uint32_t previous;  // left sibling, or parent of a leftmost child
+        uint32_t stamp;     // current generation while queued
+    };
+    
+    DynamicArray<Node> nodes;
+    DynamicArray<uint32_t> pairs;       // scratch for the two-pass merge
+    uint32_t root;
+    size_t size;
+    uint32_t generation;
+    
+    // Private helper functions to implement
+    uint32_t meld(uint32_t first, uint32_t second);
+    void cut(uint32_t vertex);
+    
+public:
+    static constexpr bool integer_keys = false;
+    
+    PairingHeap();
+    
+    void reset(size_t vertex_count);
+    void clear();
+    bool empty() const;
+    size_t getSize() const;
+    void push(uint32_t vertex, double key);
+    uint32_t pop();
+};
+
+// Monotone radix heap: entries sit in buckets by the highest bit in which
+// their key differs from the last popped key, and a pop only redistributes
+// the first non-empty bucket. Keys are whole numbers below 2^53. Lowering a
+// key adds a second entry, so a vertex comes back once per push.
+class RadixHeap {
+private:
+    struct Entry {
+        uint64_t key;
+        uint32_t vertex;
+    };
+    
+    static constexpr size_t BUCKET_COUNT = 65;
+    
+    DynamicArray<Entry> buckets[BUCKET_COUNT];
+    uint64_t last;
+    size_t size;
+    
+    // Private helper functions to implement
+    size_t bucketOf(uint64_t key) const;
+    
+public:
+    static constexpr bool integer_keys = true;
+    
+    RadixHeap();
+    
+    void reset(size_t vertex_count);
+    void clear();
+    bool empty() const;
+    size_t getSize() const;
+    void push(uint32_t vertex, double key);
+    uint32_t pop();
+};
+
+#endif
@@ -0,0 +1,107 @@
+//==================== MAPPED DYNAMIC ARRAY ====================
+#ifndef MAPPED_DYNAMIC_ARRAY_H
+#define MAPPED_DYNAMIC_ARRAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MAPPED_ARRAY_USE_MMAP 1
+#endif
+
+// Expected access pattern, passed on to the kernel's readahead
+enum class AccessHint {
+    Normal,
+    Sequential,
+    Random,
+    WillNeed    // start reading the whole array in now
+};
+
+// DynamicArray of trivially copyable records backed by a shared file mapping.
+// The array can be larger than RAM, survives the process, and reopening the
+// file maps it back in place instead of loading it. Growth extends the file
+// with ftruncate and the mapping with mremap (unmap and map elsewhere).
+template<typename T>
+class MappedDynamicArray {
+private:
+    // First bytes of the file; elements start at DATA_OFFSET
+    struct FileHeader {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t element_size;
+        uint64_t size;
+    };
+    static constexpr uint64_t FILE_MAGIC = 0x594152524150414DULL;    // "MAPARRAY"
+    static constexpr uint32_t FILE_VERSION = 1;
+    static constexpr size_t DATA_OFFSET = 4096;
+    
+    std::string path;
+    int descriptor;
+    char* region;
+    size_t region_length;
+    FileHeader* header;     // size lives here, so the file is always current
+    T* data;
+    size_t capacity;
+    
+    // Private helper functions to implement
+    void mapLength(size_t length);
+    void remap(size_t new_capacity);
+    void grow(size_t required);
+    void closeFile();
+    void moveFrom(MappedDynamicArray&& other);
+    
+public:
+    // Opens path, creating an empty array if the file does not exist
+    MappedDynamicArray(const std::string& path, size_t initial_capacity = 0);
+    MappedDynamicArray(const MappedDynamicArray& other) = delete;
+    MappedDynamicArray(MappedDynamicArray&& other) noexcept;
+    ~MappedDynamicArray();
+    
+    // Assignment operators
+    MappedDynamicArray& operator=(const MappedDynamicArray& other) = delete;
+    MappedDynamicArray& operator=(MappedDynamicArray&& other) noexcept;
+    
+    // Element access
+    T& operator[](size_t index);
+    const T& operator[](size_t index) const;
+    T& at(size_t index);
+    const T& at(size_t index) const;
+    T& front();
+    const T& front() const;
+    T& back();
+    const T& back() const;
+    T* getData();
+    const T* getData() const;
+    
+    // Capacity functions
+    size_t getSize() const;
+    size_t getCapacity() const;
+    bool empty() const;
+    void reserve(size_t new_capacity);
+    void shrinkToFit();
+    
+    // Modifiers
+    void push_back(const T& value);
+    void pop_back();
+    void insert(size_t index, const T& value);
+    void erase(size_t index);
+    void erase(size_t start_index, size_t end_index);
+    void clear();
+    void resize(size_t new_size);
+    void resize(size_t new_size, const T& value);
+    
+    // File operations
+    void adviseAccess(AccessHint hint);
+    void flush();           // blocks until dirty pages reach the disk
+    const std::string& getPath() const;
+    
+    // Iterator functions, elements are contiguous
+    T* begin();
+    T* end();
+    const T* begin() const;
+    const T* end() const;
+};
+
+#endif
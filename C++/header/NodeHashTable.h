@@ -0,0 +1,188 @@
+//==================== NODE HASH TABLE ====================
+#ifndef NODE_HASH_TABLE_H
+#define NODE_HASH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include "HashTable.h"
+
+// Indirect-storage variant of HashTable for large values. The bucket array
+// only holds 8-byte {hash, node index} slots; keys and values live in nodes
+// carved out of fixed-size chunks that never move. Rehashing moves slots,
+// never values, and references to values stay valid until they are removed.
+template<typename Key, typename Value, typename Sizing = PrimeSizing,
+         typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class NodeHashTable {
+public:
+    struct Node {
+        Key key;
+        Value value;
+        
+        // Node constructors to implement
+        Node(const Key& k, const Value& v);
+        Node(Key&& k, Value&& v);
+    };
+    
+private:
+    // One bucket: the low 32 bits of the mixed hash and the index of its node
+    struct Slot {
+        uint32_t hash;
+        uint32_t node;
+    };
+    
+    // Arena cell, either a live node or a link in the free list
+    union Cell {
+        Node node;
+        uint32_t next_free;
+        
+        Cell();
+        ~Cell();
+    };
+    
+    static constexpr uint32_t EMPTY_NODE = 0xFFFFFFFF;
+    static constexpr size_t CHUNK_SHIFT = 8;
+    static constexpr size_t CHUNK_SIZE = size_t(1) << CHUNK_SHIFT;
+    static constexpr double MAX_LOAD_FACTOR = 0.75;
+    
+    Slot* slots;
+    size_t bucket_count;
+    size_t size;
+    
+    Cell** chunks;
+    size_t chunk_count;
+    size_t chunk_capacity;
+    uint32_t node_count;        // cells handed out so far, including freed ones
+    uint32_t free_head;
+    
+    template<typename K, typename Result>
+    using IfTransparent = typename std::enable_if<IsTransparent<Hash>::value && IsTransparent<KeyEqual>::value &&
+                                                  !std::is_same<K, Key>::value, Result>::type;
+    
+    // Hash and probing functions to implement
+    template<typename K>
+    uint32_t hash(const K& key) const;
+    size_t home(uint32_t hash_value) const;
+    size_t distance(size_t slot) const;
+    size_t nextSlot(size_t slot) const;
+    
+    // Node arena functions to implement
+    Node& node(uint32_t index) const;
+    template<typename... Args>
+    uint32_t allocateNode(Args&&... args);
+    void freeNode(uint32_t index);
+    void destroyNodes();
+    
+    // Private helper functions to implement
+    template<typename K>
+    size_t findSlot(const K& key) const;
+    void placeSlot(Slot entry);
+    void eraseSlot(size_t slot);
+    void resize(size_t new_capacity);
+    bool needsResize() const;
+    template<typename... Args>
+    Value& insertNew(uint32_t hash_value, Args&&... args);
+    void initializeSlots();
+    void copyFrom(const NodeHashTable& other);
+    void moveFrom(NodeHashTable&& other);
+    
+    // Lookup helpers shared by the Key and heterogeneous overloads
+    template<typename K>
+    Value* findValue(const K& key) const;
+    template<typename K>
+    bool removeKey(const K& key);
+    
+public:
+    // Constructors and Destructor
+    NodeHashTable(size_t initial_capacity = 17);
+    NodeHashTable(const NodeHashTable& other);
+    NodeHashTable(NodeHashTable&& other) noexcept;
+    ~NodeHashTable();
+    
+    // Assignment operators
+    NodeHashTable& operator=(const NodeHashTable& other);
+    NodeHashTable& operator=(NodeHashTable&& other) noexcept;
+    
+    // Element access
+    Value& operator[](const Key& key);
+    Value& operator[](Key&& key);
+    Value& at(const Key& key);
+    const Value& at(const Key& key) const;
+    
+    // Modifiers
+    void insert(const Key& key, const Value& value);
+    void insert(Key&& key, Value&& value);
+    template<typename... Args>
+    void emplace(const Key& key, Args&&... args);
+    template<typename... Args>
+    void emplace(Key&& key, Args&&... args);
+    bool remove(const Key& key);
+    void clear();
+    void swap(NodeHashTable& other);
+    
+    // Lookup operations
+    bool contains(const Key& key) const;
+    Value* find(const Key& key);
+    const Value* find(const Key& key) const;
+    
+    // Heterogeneous lookup, same rules as HashTable
+    template<typename K>
+    IfTransparent<K, Value&> operator[](const K& key);
+    template<typename K>
+    IfTransparent<K, Value&> at(const K& key);
+    template<typename K>
+    IfTransparent<K, const Value&> at(const K& key) const;
+    template<typename K>
+    IfTransparent<K, bool> remove(const K& key);
+    template<typename K>
+    IfTransparent<K, bool> contains(const K& key) const;
+    template<typename K>
+    IfTransparent<K, Value*> find(const K& key);
+    template<typename K>
+    IfTransparent<K, const Value*> find(const K& key) const;
+    
+    // Bulk operations
+    template<typename InputIterator>
+    void insertBulk(InputIterator first, InputIterator last);
+    
+    // Capacity
+    size_t getSize() const;
+    bool empty() const;
+    size_t getBucketCount() const;
+    double getLoadFactor() const;
+    size_t getCollisionCount() const;
+    size_t getMaxProbeDistance() const;
+    double getMeanProbeDistance() const;
+    
+    // Hash table operations
+    void rehashToSize(size_t new_size);
+    void reserve(size_t min_capacity);
+    
+    // Iterator class
+    class Iterator {
+    private:
+        const NodeHashTable* table;
+        size_t current_index;
+        
+        void findNextValid();
+        
+    public:
+        Iterator();
+        Iterator(const NodeHashTable* table, size_t start_index);
+        Node& operator*() const;
+        Node* operator->() const;
+        Iterator& operator++();
+        Iterator operator++(int);
+        bool operator==(const Iterator& other) const;
+        bool operator!=(const Iterator& other) const;
+    };
+    
+    // Iterator functions
+    Iterator begin();
+    Iterator end();
+    const Iterator begin() const;
+    const Iterator end() const;
+};
+
+#endif
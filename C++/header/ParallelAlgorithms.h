@@ -0,0 +1,44 @@
+//==================== PARALLEL ALGORITHMS ====================
+#ifndef PARALLEL_ALGORITHMS_H
+#define PARALLEL_ALGORITHMS_H
+
+#include <cstddef>
+#include <functional>
+#include "ThreadPool.h"
+
+// Bulk algorithms over contiguous ranges such as DynamicArray::getData().
+// Work is split into chunks run on a ThreadPool; ranges shorter than
+// SERIAL_THRESHOLD elements per chunk stay on the calling thread.
+struct ParallelAlgorithms {
+    static constexpr size_t SERIAL_THRESHOLD = 32 * 1024;
+    
+    // Chunks are sorted in parallel and then merged pairwise, each merge split
+    // across threads at binary-searched cut points. Not stable; T must be
+    // default constructible for the merge buffer.
+    template<typename T, typename Compare = std::less<T>>
+    static void sort(T* data, size_t size, Compare compare = Compare(), ThreadPool& pool = ThreadPool::shared());
+    
+    // output[i] = function(input[i]); output may be the input range
+    template<typename T, typename U, typename Function>
+    static void transform(const T* input, size_t size, U* output, Function function,
+                          ThreadPool& pool = ThreadPool::shared());
+    
+    // combine must be associative, chunk results are combined left to right
+    template<typename T, typename Combine = std::plus<T>>
+    static T reduce(const T* data, size_t size, T initial, Combine combine = Combine(),
+                    ThreadPool& pool = ThreadPool::shared());
+    
+    // output[i] = input[0] combined with ... input[i]; output may be the input range
+    template<typename T, typename Combine = std::plus<T>>
+    static void inclusiveScan(const T* input, size_t size, T* output, Combine combine = Combine(),
+                              ThreadPool& pool = ThreadPool::shared());
+    
+private:
+    static size_t chunkCount(size_t size, size_t per_thread, const ThreadPool& pool);
+    static size_t chunkBegin(size_t size, size_t chunks, size_t chunk);
+    template<typename T, typename Compare>
+    static void findCut(const T* source, size_t low, size_t middle, size_t high, size_t piece, size_t pieces,
+                        Compare& compare, size_t& left, size_t& right);
+};
+
+#endif
@@ -0,0 +1,152 @@
+//==================== SEGMENTED ARRAY ====================
+#ifndef SEGMENTED_ARRAY_H
+#define SEGMENTED_ARRAY_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include "vectors.h"
+
+// Append-only array that grows by whole chunks of ChunkSize elements. Chunks
+// are never moved or freed while in use, so pointers and references to
+// elements stay valid until the element is popped or the array is cleared.
+// operator[] is two loads: the chunk table entry, then the element.
+template<typename T, size_t ChunkSize = 1024, typename Allocator = std::allocator<T>>
+class SegmentedArray : private Allocator {
+private:
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    
+    static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0, "ChunkSize must be a power of two");
+    
+    // Unequal allocators that do not propagate force an element-wise move into new chunks
+    static constexpr bool NOTHROW_MOVE_ASSIGN = AllocatorTraits::propagate_on_container_move_assignment::value ||
+                                                AllocatorTraits::is_always_equal::value;
+    
+    DynamicArray<T*> chunks;    // only this table reallocates, the chunks stay put
+    size_t size;
+    
+    // Private helper functions to implement
+    T* slot(size_t index) const;
+    void addChunk();
+    void releaseChunks(size_t keep);
+    void destroyElements();
+    Allocator& allocator();
+    const Allocator& allocator() const;
+    
+public:
+    // Constructors and Destructor
+    SegmentedArray();
+    explicit SegmentedArray(const Allocator& allocator);
+    SegmentedArray(const SegmentedArray& other);
+    SegmentedArray(SegmentedArray&& other) noexcept;
+    ~SegmentedArray();
+    
+    // Assignment operators
+    SegmentedArray& operator=(const SegmentedArray& other);
+    SegmentedArray& operator=(SegmentedArray&& other) noexcept(NOTHROW_MOVE_ASSIGN);
+    
+    // Element access
+    T& operator[](size_t index);
+    const T& operator[](size_t index) const;
+    T& at(size_t index);
+    const T& at(size_t index) const;
+    T& front();
+    const T& front() const;
+    T& back();
+    const T& back() const;
+    
+    // Capacity functions
+    size_t getSize() const;
+    size_t getCapacity() const;
+    size_t getChunkCount() const;
+    bool empty() const;
+    void reserve(size_t new_capacity);
+    void shrinkToFit();     // frees whole unused chunks only
+    
+    // Modifiers, appends never move existing elements
+    void push_back(const T& value);
+    void push_back(T&& value);
+    template<typename... Args>
+    T& emplace_back(Args&&... args);
+    void pop_back();
+    void clear();
+    void swap(SegmentedArray& other);
+    
+    class ConstIterator;
+    
+    // Iterator class
+    class Iterator {
+    private:
+        SegmentedArray* array;
+        size_t index;
+        friend class ConstIterator;
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+        
+        Iterator(SegmentedArray* array, size_t index);
+        T& operator*() const;
+        T* operator->() const;
+        T& operator[](size_t n) const;
+        Iterator& operator++();
+        Iterator operator++(int);
+        Iterator& operator--();
+        Iterator operator--(int);
+        Iterator operator+(size_t n) const;
+        Iterator operator-(size_t n) const;
+        Iterator& operator+=(size_t n);
+        Iterator& operator-=(size_t n);
+        ptrdiff_t operator-(const Iterator& other) const;
+        bool operator==(const Iterator& other) const;
+        bool operator!=(const Iterator& other) const;
+        bool operator<(const Iterator& other) const;
+        bool operator>(const Iterator& other) const;
+        bool operator<=(const Iterator& other) const;
+        bool operator>=(const Iterator& other) const;
+    };
+    
+    // Iterator over a const array, yields const T&
+    class ConstIterator {
+    private:
+        const SegmentedArray* array;
+        size_t index;
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+        
+        ConstIterator(const SegmentedArray* array, size_t index);
+        ConstIterator(const Iterator& other);
+        const T& operator*() const;
+        const T* operator->() const;
+        const T& operator[](size_t n) const;
+        ConstIterator& operator++();
+        ConstIterator operator++(int);
+        ConstIterator& operator--();
+        ConstIterator operator--(int);
+        ConstIterator operator+(size_t n) const;
+        ConstIterator operator-(size_t n) const;
+        ConstIterator& operator+=(size_t n);
+        ConstIterator& operator-=(size_t n);
+        ptrdiff_t operator-(const ConstIterator& other) const;
+        bool operator==(const ConstIterator& other) const;
+        bool operator!=(const ConstIterator& other) const;
+        bool operator<(const ConstIterator& other) const;
+        bool operator>(const ConstIterator& other) const;
+        bool operator<=(const ConstIterator& other) const;
+        bool operator>=(const ConstIterator& other) const;
+    };
+    
+    // Iterator functions
+    Iterator begin();
+    Iterator end();
+    ConstIterator begin() const;
+    ConstIterator end() const;
+};
+
+#endif
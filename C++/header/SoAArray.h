@@ -0,0 +1,191 @@
+//==================== STRUCTURE OF ARRAYS ====================
+#ifndef SOA_ARRAY_H
+#define SOA_ARRAY_H
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "vectors.h"
+
+// Array of records stored one field per DynamicArray, so a loop that reads
+// two fields of a wide record only streams those two columns. Elements are
+// accessed through proxies: array[i].get<1>() is a reference into column 1.
+template<typename... Fields>
+class SoAArray {
+public:
+    using Value = std::tuple<Fields...>;
+    template<size_t I>
+    using FieldType = typename std::tuple_element<I, Value>::type;
+    
+    // Proxy for one element, refers to the array and an index
+    class Reference {
+    private:
+        SoAArray* array;
+        size_t index;
+    public:
+        Reference(SoAArray* array, size_t index);
+        Reference(const Reference& other) = default;    // copies the proxy, operator= copies the element
+        template<size_t I>
+        FieldType<I>& get() const;
+        Reference& operator=(const Value& value);
+        Reference& operator=(const Reference& other);
+        operator Value() const;
+        void swap(const Reference& other) const;
+        
+        // Proxies are prvalues, so std::swap cannot bind them; algorithms find this one instead
+        friend void swap(Reference a, Reference b) { a.swap(b); }
+    };
+    
+    class ConstReference {
+    private:
+        const SoAArray* array;
+        size_t index;
+    public:
+        ConstReference(const SoAArray* array, size_t index);
+        template<size_t I>
+        const FieldType<I>& get() const;
+        operator Value() const;
+    };
+    
+private:
+    std::tuple<DynamicArray<Fields>...> columns;
+    size_t size;
+    
+    // One argument per field; a single whole Value goes to its own overload
+    template<typename... Args>
+    using IfFieldArguments = typename std::enable_if<sizeof...(Args) == sizeof...(Fields) &&
+                                                     !std::is_same<std::tuple<typename std::decay<Args>::type...>,
+                                                                   std::tuple<Value>>::value>::type;
+    
+    // Private helper functions to implement
+    template<typename... Args, size_t... I>
+    void pushColumns(std::index_sequence<I...>, Args&&... values);
+    template<size_t... I>
+    void popColumns(std::index_sequence<I...>, size_t count);
+    template<size_t... I>
+    void assignRow(std::index_sequence<I...>, size_t index, const Value& value);
+    template<size_t... I>
+    Value loadRow(std::index_sequence<I...>, size_t index) const;
+    template<size_t... I>
+    void swapRows(std::index_sequence<I...>, size_t first, size_t second);
+    template<typename Function>
+    void forEachColumn(Function&& function);
+    void growIfFull();
+    
+public:
+    // Constructors and Destructor
+    SoAArray();
+    SoAArray(size_t initial_capacity);
+    
+    // Element access
+    Reference operator[](size_t index);
+    ConstReference operator[](size_t index) const;
+    Reference at(size_t index);
+    ConstReference at(size_t index) const;
+    Reference front();
+    ConstReference front() const;
+    Reference back();
+    ConstReference back() const;
+    
+    // Contiguous storage of one field, for tight loops over a single column
+    template<size_t I>
+    FieldType<I>* column();
+    template<size_t I>
+    const FieldType<I>* column() const;
+    
+    // Capacity functions
+    size_t getSize() const;
+    size_t getCapacity() const;
+    bool empty() const;
+    void reserve(size_t new_capacity);
+    void shrinkToFit();
+    
+    // Modifiers
+    template<typename... Args, typename = IfFieldArguments<Args...>>
+    void push_back(Args&&... values);
+    void push_back(const Value& value);
+    void pop_back();
+    void erase(size_t index);
+    void erase(size_t start_index, size_t end_index);
+    void clear();
+    void swap(SoAArray& other);
+    
+    class ConstIterator;
+    
+    // Random access iterators whose reference type is a proxy, like
+    // std::vector<bool>; sorting works through Reference and its swap
+    class Iterator {
+    private:
+        SoAArray* array;
+        size_t index;
+        friend class ConstIterator;
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Value;
+        using difference_type = ptrdiff_t;
+        using pointer = void;
+        using reference = Reference;
+        
+        Iterator(SoAArray* array, size_t index);
+        Reference operator*() const;
+        Reference operator[](size_t n) const;
+        Iterator& operator++();
+        Iterator operator++(int);
+        Iterator& operator--();
+        Iterator operator--(int);
+        Iterator operator+(size_t n) const;
+        Iterator operator-(size_t n) const;
+        Iterator& operator+=(size_t n);
+        Iterator& operator-=(size_t n);
+        ptrdiff_t operator-(const Iterator& other) const;
+        bool operator==(const Iterator& other) const;
+        bool operator!=(const Iterator& other) const;
+        bool operator<(const Iterator& other) const;
+        bool operator>(const Iterator& other) const;
+        bool operator<=(const Iterator& other) const;
+        bool operator>=(const Iterator& other) const;
+    };
+    
+    // Iterator over a const array, yields ConstReference proxies
+    class ConstIterator {
+    private:
+        const SoAArray* array;
+        size_t index;
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Value;
+        using difference_type = ptrdiff_t;
+        using pointer = void;
+        using reference = ConstReference;
+        
+        ConstIterator(const SoAArray* array, size_t index);
+        ConstIterator(const Iterator& other);
+        ConstReference operator*() const;
+        ConstReference operator[](size_t n) const;
+        ConstIterator& operator++();
+        ConstIterator operator++(int);
+        ConstIterator& operator--();
+        ConstIterator operator--(int);
+        ConstIterator operator+(size_t n) const;
+        ConstIterator operator-(size_t n) const;
+        ConstIterator& operator+=(size_t n);
+        ConstIterator& operator-=(size_t n);
+        ptrdiff_t operator-(const ConstIterator& other) const;
+        bool operator==(const ConstIterator& other) const;
+        bool operator!=(const ConstIterator& other) const;
+        bool operator<(const ConstIterator& other) const;
+        bool operator>(const ConstIterator& other) const;
+        bool operator<=(const ConstIterator& other) const;
+        bool operator>=(const ConstIterator& other) const;
+    };
+    
+    // Iterator functions
+    Iterator begin();
+    Iterator end();
+    ConstIterator begin() const;
+    ConstIterator end() const;
+};
+
+#endif
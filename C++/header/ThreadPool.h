@@ -0,0 +1,60 @@
+//==================== THREAD POOL ====================
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Work-stealing pool for fork-join loops. Every worker owns a queue and takes
+// its newest task first; idle workers steal the oldest task from the others.
+// A thread waiting in parallelFor runs queued tasks instead of blocking, so
+// parallel loops may nest without deadlocking the pool.
+class ThreadPool {
+private:
+    using Task = std::function<void()>;
+    
+    struct alignas(64) WorkQueue {
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+    
+    WorkQueue* queues;              // one per worker, the last one takes outside submissions
+    std::thread* workers;
+    size_t thread_count;            // workers plus the calling thread
+    std::atomic<ptrdiff_t> pending; // queued tasks not yet picked up
+    bool stopping;
+    std::mutex sleep_lock;
+    std::condition_variable wake;
+    
+    static thread_local ThreadPool* current_pool;
+    static thread_local size_t current_queue;
+    
+    // Private helper functions to implement
+    void submit(Task task);
+    bool popTask(size_t queue, bool steal, Task& task);
+    bool runPendingTask(size_t home);
+    size_t homeQueue() const;
+    void workerLoop(size_t index);
+    
+public:
+    // Constructors and Destructor
+    explicit ThreadPool(size_t thread_count = 0);     // 0 uses every hardware thread
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+    ~ThreadPool();
+    
+    // Runs function(i) for every i in [0, count) and returns once all are done;
+    // the first exception thrown by a task is rethrown here
+    template<typename Function>
+    void parallelFor(size_t count, Function&& function);
+    
+    size_t getThreadCount() const;
+    static ThreadPool& shared();
+};
+
+#endif
@@ -0,0 +1,149 @@
+//==================== ALLOCATORS ====================
+#ifndef ALLOCATORS_H
+#define ALLOCATORS_H
+
+#include <cstddef>
+#include <type_traits>
+
+// Bump-pointer arena. Allocation is a pointer increment inside the current
+// block, individual frees are ignored, and reset() drops everything at once.
+// Destructors are not run on reset, so it suits trivially destructible data.
+class Arena {
+private:
+    struct Block {
+        Block* next;
+        size_t capacity;
+        size_t used;
+    };
+    
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+    static constexpr size_t BLOCK_HEADER = (sizeof(Block) + alignof(std::max_align_t) - 1) /
+                                           alignof(std::max_align_t) * alignof(std::max_align_t);
+    
+    Block* head;
+    size_t block_size;
+    size_t bytes_allocated;
+    
+    // Private helper functions to implement
+    static char* blockData(Block* block);
+    Block* addBlock(size_t min_bytes);
+    void releaseBlocks(Block* first);
+    
+public:
+    Arena(size_t block_size = DEFAULT_BLOCK_SIZE);
+    Arena(const Arena& other) = delete;
+    Arena& operator=(const Arena& other) = delete;
+    ~Arena();
+    
+    void* allocate(size_t bytes, size_t alignment);
+    bool release(void* pointer, size_t bytes);     // rolls back only the latest allocation
+    void reset();                                  // keeps one block for reuse
+    size_t getBytesAllocated() const;
+};
+
+// Arena with per-size-class free lists: freed buffers are recycled for later
+// allocations of the same rounded size instead of being abandoned
+class MemoryPool {
+private:
+    static constexpr size_t MIN_CLASS_SHIFT = 4;
+    static constexpr size_t CLASS_COUNT = 48;
+    
+    struct FreeNode {
+        FreeNode* next;
+    };
+    
+    Arena arena;
+    FreeNode* free_lists[CLASS_COUNT];
+    
+    static size_t sizeClass(size_t bytes);
+    
+public:
+    MemoryPool(size_t block_size = 64 * 1024);
+    
+    void* allocate(size_t bytes);                  // aligned for any fundamental type
+    void deallocate(void* pointer, size_t bytes);
+    void reset();
+    size_t getBytesAllocated() const;
+};
+
+// Standard allocator front ends for the containers; copies share the same arena or pool
+template<typename T>
+class ArenaAllocator {
+private:
+    Arena* arena;
+    
+    template<typename U>
+    friend class ArenaAllocator;
+    
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    
+    ArenaAllocator(Arena& arena) noexcept;
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept;
+    
+    T* allocate(size_t count);
+    void deallocate(T* pointer, size_t count) noexcept;
+    Arena* getArena() const;
+    
+    template<typename U>
+    bool operator==(const ArenaAllocator<U>& other) const;
+    template<typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const;
+};
+
+template<typename T>
+class PoolAllocator {
+private:
+    MemoryPool* pool;
+    
+    template<typename U>
+    friend class PoolAllocator;
+    
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    
+    PoolAllocator(MemoryPool& pool) noexcept;
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept;
+    
+    T* allocate(size_t count);
+    void deallocate(T* pointer, size_t count) noexcept;
+    MemoryPool* getPool() const;
+    
+    template<typename U>
+    bool operator==(const PoolAllocator<U>& other) const;
+    template<typename U>
+    bool operator!=(const PoolAllocator<U>& other) const;
+};
+
+// Large allocations come from 2 MB aligned anonymous mappings marked for
+// transparent huge pages (Linux); smaller ones and other platforms use new
+template<typename T>
+class HugePageAllocator {
+public:
+    static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    
+    using value_type = T;
+    using is_always_equal = std::true_type;
+    
+    HugePageAllocator() noexcept;
+    template<typename U>
+    HugePageAllocator(const HugePageAllocator<U>& other) noexcept;
+    
+    T* allocate(size_t count);
+    void deallocate(T* pointer, size_t count) noexcept;
+    
+    template<typename U>
+    bool operator==(const HugePageAllocator<U>& other) const;
+    template<typename U>
+    bool operator!=(const HugePageAllocator<U>& other) const;
+};
+
+#endif
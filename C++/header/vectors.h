@@ -2,33 +2,182 @@
 #ifndef DYNAMIC_ARRAY_H
 #define DYNAMIC_ARRAY_H
 
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DYNAMIC_ARRAY_USE_SSE2 1
+#endif
+
+#if defined(DYNAMIC_ARRAY_USE_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define DYNAMIC_ARRAY_USE_AVX2 1    // built with a target attribute, selected at run time
+#define DYNAMIC_ARRAY_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define DYNAMIC_ARRAY_AVX2_TARGET
+#endif
+
+// Checked iterators remember their array and its generation, and throw when
+// dereferenced out of bounds or after the array moved its storage. Unchecked
+// iterators are plain pointers. Off by default; define the macro to 1 for every
+// translation unit of a program to opt in. It is deliberately not tied to
+// NDEBUG: the setting changes the iterator layout, and linking debug and
+// release objects together would otherwise break the one definition rule.
+#ifndef DYNAMIC_ARRAY_CHECKED_ITERATORS
+#define DYNAMIC_ARRAY_CHECKED_ITERATORS 0
+#endif
+
+// Types whose objects can be moved to a new address with a byte copy, without
+// running the move constructor and destructor. Trivially copyable types qualify;
+// specialize to true_type for others that do (e.g. types holding a unique_ptr).
 template<typename T>
-class DynamicArray {
+struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+// Search kernels behind find, findLast and count for arithmetic element types.
+// AVX2 is used when the running CPU has it, then SSE2, then a scalar loop;
+// every path gives the same answer as comparing elements with ==.
+template<typename T>
+struct SearchKernels {
+    static constexpr bool vectorizable = std::is_arithmetic<T>::value &&
+                                         (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+    
+    static size_t find(const T* data, size_t size, T value);
+    static size_t findLast(const T* data, size_t size, T value);
+    static size_t count(const T* data, size_t size, T value);
+    
 private:
-    T* data;
+    // Byte masks: each matching element sets sizeof(T) consecutive bits
+    static uint32_t matchSse2(const T* block, T value);
+    DYNAMIC_ARRAY_AVX2_TARGET static uint32_t matchAvx2(const T* block, T value);
+    static size_t findSse2(const T* data, size_t size, T value);
+    static size_t findLastSse2(const T* data, size_t size, T value);
+    static size_t countSse2(const T* data, size_t size, T value);
+    DYNAMIC_ARRAY_AVX2_TARGET static size_t findAvx2(const T* data, size_t size, T value);
+    DYNAMIC_ARRAY_AVX2_TARGET static size_t findLastAvx2(const T* data, size_t size, T value);
+    DYNAMIC_ARRAY_AVX2_TARGET static size_t countAvx2(const T* data, size_t size, T value);
+    static bool hasAvx2();
+    static size_t lowestBit(uint32_t mask);
+    static size_t highestBit(uint32_t mask);
+    static size_t popCount(uint32_t mask);
+};
+
+// Storage for the first InlineCapacity elements inside the array object itself;
+// the empty specialization costs nothing for plain heap arrays
+template<typename T, size_t InlineCapacity>
+struct InlineBuffer {
+    alignas(T) unsigned char bytes[InlineCapacity * sizeof(T)];
+    
+    T* inlineData();
+};
+
+template<typename T>
+struct InlineBuffer<T, 0> {
+    T* inlineData();
+};
+
+// Growth policies, chosen at compile time: grow(capacity, required) gives the
+// capacity to move to when an insertion needs room for required elements.
+// track_stats turns on the reallocation counters reported by getGrowthStats.
+struct DoublingGrowth {
+    static constexpr bool track_stats = false;
+    static size_t grow(size_t capacity, size_t required);
+};
+
+struct ThreeHalvesGrowth {
+    static constexpr bool track_stats = false;
+    static size_t grow(size_t capacity, size_t required);   // at most a third of the buffer unused
+};
+
+// Rounds up to a multiple of ChunkSize elements; slack stays below one chunk,
+// but appending n elements one by one costs n / ChunkSize reallocations
+template<size_t ChunkSize>
+struct ChunkGrowth {
+    static constexpr bool track_stats = false;
+    static size_t grow(size_t capacity, size_t required);
+};
+
+// Doubles up to Threshold elements, then allocates exactly what is required;
+// meant for large arrays filled through reserve, resize or insert(count)
+template<size_t Threshold>
+struct ExactAfterThresholdGrowth {
+    static constexpr bool track_stats = false;
+    static size_t grow(size_t capacity, size_t required);
+};
+
+// Same growth as Policy, with the reallocation counters switched on
+template<typename Policy>
+struct TrackedGrowth : Policy {
+    static constexpr bool track_stats = true;
+};
+
+struct GrowthStats {
+    size_t reallocations = 0;
+    size_t bytes_copied = 0;        // element bytes moved to a new buffer
+    size_t peak_slack_bytes = 0;    // largest unused capacity right after a reallocation
+};
+
+template<bool Enabled>
+struct GrowthCounters {
+    GrowthStats growth_stats;
+};
+
+template<>
+struct GrowthCounters<false> {};
+
+// Allocator follows the std::allocator_traits protocol; the default keeps
+// plain global new/delete. See allocators.h for arena, pool and huge-page ones.
+template<typename T, size_t InlineCapacity = 0, typename Allocator = std::allocator<T>, typename Growth = DoublingGrowth>
+class DynamicArray : private InlineBuffer<T, InlineCapacity>, private Allocator,
+                     private GrowthCounters<Growth::track_stats> {
+private:
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    
+    // Elements on the inline buffer cannot change hands and are moved one by one
+    static constexpr bool NOTHROW_MOVE = InlineCapacity == 0 || IsTriviallyRelocatable<T>::value ||
+                                         std::is_nothrow_move_constructible<T>::value;
+    // Unequal allocators that do not propagate force an element-wise move into new storage
+    static constexpr bool NOTHROW_MOVE_ASSIGN = NOTHROW_MOVE &&
+                                                (AllocatorTraits::propagate_on_container_move_assignment::value ||
+                                                 AllocatorTraits::is_always_equal::value);
+    
+    T* data;                // inline buffer until the first spill to the heap
     size_t size;
     size_t capacity;
-    
+#if DYNAMIC_ARRAY_CHECKED_ITERATORS
+    size_t generation = 0;  // bumped whenever data moves to other storage
+#endif
+
     // Private helper functions to implement
     void resize();
+    void grow(size_t required);
     void reallocate(size_t new_capacity);
     void copyData(const T* source, T* destination, size_t count);
     void destroyElements();
     void shiftElementsRight(size_t index, size_t positions);
     void shiftElementsLeft(size_t index, size_t positions);
+    bool isInline() const;
+    void releaseStorage();
+    void moveFrom(DynamicArray&& other);
+    Allocator& allocator();
+    const Allocator& allocator() const;
+    void resetToInline();
+    void invalidateIterators();
     
 public:
     // Constructors and Destructor
     DynamicArray();
-    DynamicArray(size_t initial_capacity);
-    DynamicArray(size_t count, const T& value);
+    explicit DynamicArray(const Allocator& allocator);
+    DynamicArray(size_t initial_capacity, const Allocator& allocator = Allocator());
+    DynamicArray(size_t count, const T& value, const Allocator& allocator = Allocator());
     DynamicArray(const DynamicArray& other);
-    DynamicArray(DynamicArray&& other) noexcept;
+    DynamicArray(DynamicArray&& other) noexcept(NOTHROW_MOVE);
     ~DynamicArray();
     
     // Assignment operators
     DynamicArray& operator=(const DynamicArray& other);
-    DynamicArray& operator=(DynamicArray&& other) noexcept;
+    DynamicArray& operator=(DynamicArray&& other) noexcept(NOTHROW_MOVE_ASSIGN);
     
     // Element access
     T& operator[](size_t index);
@@ -41,6 +190,7 @@ public:
     const T& back() const;
     T* getData();
     const T* getData() const;
+    Allocator getAllocator() const;
     
     // Capacity functions
     size_t getSize() const;
@@ -48,6 +198,8 @@ public:
     bool empty() const;
     void reserve(size_t new_capacity);
     void shrinkToFit();
+    GrowthStats getGrowthStats() const;     // all zero unless Growth tracks stats
+    void resetGrowthStats();
     
     // Modifiers
     void push_back(const T& value);
@@ -74,13 +226,27 @@ public:
     size_t findLast(const T& value) const;
     size_t count(const T& value) const;
     bool equals(const DynamicArray& other) const;
+
+#if DYNAMIC_ARRAY_CHECKED_ITERATORS
+    class ConstIterator;
     
     // Iterator class
     class Iterator {
     private:
         T* ptr;
+        const DynamicArray* array;
+        size_t generation;
+        
+        friend class ConstIterator;
+        T* checked(size_t n) const;     // ptr + n, once it is known to be a live element
     public:
-        Iterator(T* p);
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+        
+        Iterator(T* p, const DynamicArray* array);
         Iterator(const Iterator& other);
         Iterator& operator=(const Iterator& other);
         T& operator*();
@@ -106,15 +272,73 @@ public:
         const T& operator[](size_t n) const;
     };
     
+    // Same checks as Iterator, for const arrays; an Iterator converts to it
+    class ConstIterator {
+    private:
+        const T* ptr;
+        const DynamicArray* array;
+        size_t generation;
+        
+        const T* checked(size_t n) const;
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+        
+        ConstIterator(const T* p, const DynamicArray* array);
+        ConstIterator(const Iterator& other);
+        ConstIterator(const ConstIterator& other);
+        ConstIterator& operator=(const ConstIterator& other);
+        const T& operator*() const;
+        const T* operator->() const;
+        ConstIterator& operator++();
+        ConstIterator operator++(int);
+        ConstIterator& operator--();
+        ConstIterator operator--(int);
+        ConstIterator operator+(size_t n) const;
+        ConstIterator operator-(size_t n) const;
+        ConstIterator& operator+=(size_t n);
+        ConstIterator& operator-=(size_t n);
+        ptrdiff_t operator-(const ConstIterator& other) const;
+        bool operator==(const ConstIterator& other) const;
+        bool operator!=(const ConstIterator& other) const;
+        bool operator<(const ConstIterator& other) const;
+        bool operator>(const ConstIterator& other) const;
+        bool operator<=(const ConstIterator& other) const;
+        bool operator>=(const ConstIterator& other) const;
+        const T& operator[](size_t n) const;
+    };
+#else
+    // Unchecked iterators are raw pointers, so loops over them vectorize
+    using Iterator = T*;
+    using ConstIterator = const T*;
+#endif
+    
+    // Dereferences the element before its base, so rend() never points outside the array
+    using ReverseIterator = std::reverse_iterator<Iterator>;
+    using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+private:
+    Iterator makeIterator(T* position) const;
+    ConstIterator makeConstIterator(const T* position) const;
+    
+public:
     // Iterator functions
     Iterator begin();
     Iterator end();
-    const Iterator begin() const;
-    const Iterator end() const;
-    Iterator rbegin();
-    Iterator rend();
-    const Iterator rbegin() const;
-    const Iterator rend() const;
+    ConstIterator begin() const;
+    ConstIterator end() const;
+    ReverseIterator rbegin();
+    ReverseIterator rend();
+    ConstReverseIterator rbegin() const;
+    ConstReverseIterator rend() const;
 };
 
-#endif
\ No newline at end of file
+// Keeps up to N elements inside the object and only allocates past that,
+// for the many short-lived arrays of two to eight elements
+template<typename T, size_t N, typename Allocator = std::allocator<T>, typename Growth = DoublingGrowth>
+using SmallDynamicArray = DynamicArray<T, N, Allocator, Growth>;
+
+#endif
@@ -0,0 +1,558 @@
+//==================== CSR GRAPH IMPLEMENTATION ====================
+#ifndef CSR_GRAPH_CPP
+#define CSR_GRAPH_CPP
+
+#include <stdexcept>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <utility>
+#include "../header/CSRGraph.h"
+#include "vectors.cpp"
+#include "HashTable.cpp"
+#include "ThreadPool.cpp"
+
+//==================== PRIVATE HELPER FUNCTIONS ====================
+
+template<typename T>
+CSRGraph<T>::CSRGraph(bool directed, bool weighted)
+    : ids(16, ProbingMode::Group), edge_count(0), is_directed(directed), is_weighted(weighted) {
+    offsets.push_back(0);
+}
+
+template<typename T>
+void CSRGraph<T>::buildTranspose() {
+    // Counting sort of the edges by target; sources are scanned in id order,
+    // so every in-edge row comes out sorted as well
+    size_t n = vertices.getSize();
+    in_offsets.assign(n + 1, 0);
+    for (size_t k = 0; k < targets.getSize(); ++k) {
+        ++in_offsets[targets[k] + 1];
+    }
+    for (size_t v = 0; v < n; ++v) {
+        in_offsets[v + 1] += in_offsets[v];
+    }
+    
+    in_sources.resize(targets.getSize());
+    in_weights.resize(targets.getSize());
+    DynamicArray<size_t> cursor(in_offsets);
+    for (size_t v = 0; v < n; ++v) {
+        for (size_t k = offsets[v]; k < offsets[v + 1]; ++k) {
+            size_t slot = cursor[targets[k]]++;
+            in_sources[slot] = static_cast<uint32_t>(v);
+            in_weights[slot] = weights[k];
+        }
+    }
+}
+
+template<typename T>
+uint32_t CSRGraph<T>::requireId(const T& vertex) const {
+    const uint32_t* id = ids.find(vertex);
+    if (!id) {
+        throw std::out_of_range("Vertex not found");
+    }
+    return *id;
+}
+
+template<typename T>
+size_t CSRGraph<T>::reachable(uint32_t source, uint32_t stop, bool both_directions, bool* visited, uint32_t* queue) const {
+    // Breadth-first; queue receives the vertices in visiting order and the count is returned
+    size_t tail = 0;
+    visited[source] = true;
+    queue[tail++] = source;
+    auto expand = [&](const DynamicArray<size_t>& row_offsets, const DynamicArray<uint32_t>& row_targets, uint32_t vertex) {
+        for (size_t k = row_offsets[vertex]; k < row_offsets[vertex + 1]; ++k) {
+            uint32_t next = row_targets[k];
+            if (!visited[next]) {
+                visited[next] = true;
+                queue[tail++] = next;
+            }
+        }
+    };
+    for (size_t head = 0; head < tail; ++head) {
+        uint32_t vertex = queue[head];
+        if (vertex == stop) {
+            break;
+        }
+        expand(offsets, targets, vertex);
+        if (both_directions && is_directed) {
+            expand(in_offsets, in_sources, vertex);
+        }
+    }
+    return tail;
+}
+
+template<typename T>
+void CSRGraph<T>::shortestPaths(uint32_t source, uint32_t stop, double* distances, uint32_t* previous) const {
+    size_t n = vertices.getSize();
+    std::fill(distances, distances + n, std::numeric_limits<double>::infinity());
+    std::fill(previous, previous + n, NO_VERTEX);
+    
+    // Binary heap of (distance, vertex); outdated entries are skipped when popped
+    DynamicArray<bool> settled(n, false);
+    DynamicArray<std::pair<double, uint32_t>> heap;
+    std::greater<std::pair<double, uint32_t>> later;
+    distances[source] = 0.0;
+    heap.push_back(std::make_pair(0.0, source));
+    
+    while (!heap.empty()) {
+        std::pop_heap(heap.getData(), heap.getData() + heap.getSize(), later);
+        uint32_t vertex = heap.back().second;
+        heap.pop_back();
+        if (settled[vertex]) {
+            continue;
+        }
+        settled[vertex] = true;
+        if (vertex == stop) {
+            break;
+        }
+        for (size_t k = offsets[vertex]; k < offsets[vertex + 1]; ++k) {
+            if (weights[k] < 0.0) {
+                throw std::invalid_argument("Dijkstra needs non-negative edge weights");
+            }
+            uint32_t next = targets[k];
+            double candidate = distances[vertex] + weights[k];
+            if (candidate < distances[next]) {
+                distances[next] = candidate;
+                previous[next] = vertex;
+                heap.push_back(std::make_pair(candidate, next));
+                std::push_heap(heap.getData(), heap.getData() + heap.getSize(), later);
+            }
+        }
+    }
+}
+
+template<typename T>
+size_t CSRGraph<T>::bfsTaskCount(size_t work, const ThreadPool& pool) {
+    return std::max<size_t>(1, std::min(pool.getThreadCount() * 4, (work + BFS_GRAIN - 1) / BFS_GRAIN));
+}
+
+template<typename T>
+size_t CSRGraph<T>::topDownStep(const DynamicArray<uint32_t>& frontier, DynamicArray<uint32_t>& next,
+                                std::atomic<uint64_t>* visited, uint32_t* distances, uint32_t* parents,
+                                ThreadPool& pool) const {
+    // Tasks split the frontier and claim unvisited targets with fetch_or, so each
+    // vertex is written by exactly one parent. Returns the new frontier's out-edges.
+    size_t size = frontier.getSize();
+    size_t tasks = bfsTaskCount(size, pool);
+    DynamicArray<DynamicArray<uint32_t>> found;
+    DynamicArray<size_t> found_edges(tasks, 0);
+    found.resize(tasks);
+    pool.parallelFor(tasks, [&](size_t task) {
+        DynamicArray<uint32_t> claimed;
+        size_t claimed_edges = 0;
+        for (size_t i = size * task / tasks; i < size * (task + 1) / tasks; ++i) {
+            uint32_t vertex = frontier[i];
+            for (size_t k = offsets[vertex]; k < offsets[vertex + 1]; ++k) {
+                uint32_t next_vertex = targets[k];
+                std::atomic<uint64_t>& word = visited[next_vertex / 64];
+                uint64_t bit = uint64_t(1) << (next_vertex % 64);
+                if ((word.load(std::memory_order_relaxed) & bit) == 0 &&
+                    (word.fetch_or(bit, std::memory_order_relaxed) & bit) == 0) {
+                    distances[next_vertex] = distances[vertex] + 1;
+                    parents[next_vertex] = vertex;
+                    claimed.push_back(next_vertex);
+                    claimed_edges += offsets[next_vertex + 1] - offsets[next_vertex];
+                }
+            }
+        }
+        found[task].swap(claimed);
+        found_edges[task] = claimed_edges;
+    });
+    
+    size_t total = 0;
+    size_t frontier_edges = 0;
+    for (size_t task = 0; task < tasks; ++task) {
+        total += found[task].getSize();
+        frontier_edges += found_edges[task];
+    }
+    next.resize(total);
+    uint32_t* out = next.getData();
+    for (size_t task = 0; task < tasks; ++task) {
+        out = std::copy(found[task].getData(), found[task].getData() + found[task].getSize(), out);
+    }
+    return frontier_edges;
+}
+
+template<typename T>
+size_t CSRGraph<T>::bottomUpStep(const DynamicArray<uint64_t>& frontier, DynamicArray<uint64_t>& next,
+                                 std::atomic<uint64_t>* visited, uint32_t* distances, uint32_t* parents,
+                                 size_t& frontier_edges, ThreadPool& pool) const {
+    // Each unvisited vertex scans its in-edges and stops at the first parent in
+    // the frontier bitmap. Tasks own whole words of the bitmaps, so only the
+    // visited words shared with top-down steps need atomics.
+    size_t n = vertices.getSize();
+    size_t words = frontier.getSize();
+    const DynamicArray<size_t>& row_offsets = is_directed ? in_offsets : offsets;
+    const DynamicArray<uint32_t>& row_sources = is_directed ? in_sources : targets;
+    size_t tasks = bfsTaskCount(n, pool);
+    DynamicArray<size_t> found(tasks, 0);
+    DynamicArray<size_t> found_edges(tasks, 0);
+    pool.parallelFor(tasks, [&](size_t task) {
+        size_t claimed = 0;
+        size_t claimed_edges = 0;
+        for (size_t w = words * task / tasks; w < words * (task + 1) / tasks; ++w) {
+            uint64_t seen = visited[w].load(std::memory_order_relaxed);
+            uint64_t reached = 0;
+            for (size_t bit = 0; bit < 64 && w * 64 + bit < n; ++bit) {
+                if ((seen >> bit) & 1) {
+                    continue;
+                }
+                size_t vertex = w * 64 + bit;
+                for (size_t k = row_offsets[vertex]; k < row_offsets[vertex + 1]; ++k) {
+                    uint32_t source = row_sources[k];
+                    if ((frontier[source / 64] >> (source % 64)) & 1) {
+                        distances[vertex] = distances[source] + 1;
+                        parents[vertex] = source;
+                        reached |= uint64_t(1) << bit;
+                        ++claimed;
+                        claimed_edges += offsets[vertex + 1] - offsets[vertex];
+                        break;
+                    }
+                }
+            }
+            next[w] = reached;
+            if (reached) {
+                visited[w].fetch_or(reached, std::memory_order_relaxed);
+            }
+        }
+        found[task] = claimed;
+        found_edges[task] = claimed_edges;
+    });
+    
+    size_t total = 0;
+    frontier_edges = 0;
+    for (size_t task = 0; task < tasks; ++task) {
+        total += found[task];
+        frontier_edges += found_edges[task];
+    }
+    return total;
+}
+
+//==================== CONSTRUCTORS ====================
+
+template<typename T>
+CSRGraph<T>::CSRGraph() : CSRGraph(false, false) {}
+
+//==================== VERTICES AND IDS ====================
+
+template<typename T>
+size_t CSRGraph<T>::getVertexCount() const {
+    return vertices.getSize();
+}
+
+template<typename T>
+size_t CSRGraph<T>::getEdgeCount() const {
+    return edge_count;
+}
+
+template<typename T>
+bool CSRGraph<T>::isDirected() const {
+    return is_directed;
+}
+
+template<typename T>
+bool CSRGraph<T>::isWeighted() const {
+    return is_weighted;
+}
+
+template<typename T>
+bool CSRGraph<T>::hasVertex(const T& vertex) const {
+    return ids.find(vertex) != nullptr;
+}
+
+template<typename T>
+uint32_t CSRGraph<T>::getId(const T& vertex) const {
+    return requireId(vertex);
+}
+
+template<typename T>
+const T& CSRGraph<T>::getVertex(uint32_t id) const {
+    return vertices[id];
+}
+
+//==================== ADJACENCY ====================
+
+template<typename T>
+const uint32_t* CSRGraph<T>::getNeighbors(uint32_t id, size_t& neighbor_count) const {
+    neighbor_count = offsets[id + 1] - offsets[id];
+    return targets.getData() + offsets[id];
+}
+
+template<typename T>
+const double* CSRGraph<T>::getWeights(uint32_t id, size_t& weight_count) const {
+    weight_count = offsets[id + 1] - offsets[id];
+    return weights.getData() + offsets[id];
+}
+
+template<typename T>
+const uint32_t* CSRGraph<T>::getInNeighbors(uint32_t id, size_t& neighbor_count) const {
+    if (!is_directed) {
+        return getNeighbors(id, neighbor_count);
+    }
+    neighbor_count = in_offsets[id + 1] - in_offsets[id];
+    return in_sources.getData() + in_offsets[id];
+}
+
+template<typename T>
+const double* CSRGraph<T>::getInWeights(uint32_t id, size_t& weight_count) const {
+    if (!is_directed) {
+        return getWeights(id, weight_count);
+    }
+    weight_count = in_offsets[id + 1] - in_offsets[id];
+    return in_weights.getData() + in_offsets[id];
+}
+
+template<typename T>
+size_t CSRGraph<T>::getOutDegree(uint32_t id) const {
+    return offsets[id + 1] - offsets[id];
+}
+
+template<typename T>
+size_t CSRGraph<T>::getInDegree(uint32_t id) const {
+    return is_directed ? in_offsets[id + 1] - in_offsets[id] : getOutDegree(id);
+}
+
+template<typename T>
+bool CSRGraph<T>::hasEdge(const T& source, const T& destination) const {
+    const uint32_t* from = ids.find(source);
+    const uint32_t* to = ids.find(destination);
+    if (!from || !to) {
+        return false;
+    }
+    const uint32_t* first = targets.getData() + offsets[*from];
+    const uint32_t* last = targets.getData() + offsets[*from + 1];
+    return std::binary_search(first, last, *to);
+}
+
+template<typename T>
+double CSRGraph<T>::getEdgeWeight(const T& source, const T& destination) const {
+    const uint32_t* from = ids.find(source);
+    const uint32_t* to = ids.find(destination);
+    if (from && to) {
+        const uint32_t* first = targets.getData() + offsets[*from];
+        const uint32_t* last = targets.getData() + offsets[*from + 1];
+        const uint32_t* position = std::lower_bound(first, last, *to);
+        if (position != last && *position == *to) {
+            return weights[position - targets.getData()];
+        }
+    }
+    throw std::out_of_range("Edge not found");
+}
+
+//==================== ALGORITHMS ====================
+
+template<typename T>
+void CSRGraph<T>::breadthFirstSearch(const T& start_vertex, void (*visit)(const T&)) const {
+    uint32_t start = requireId(start_vertex);
+    DynamicArray<bool> visited(vertices.getSize(), false);
+    DynamicArray<uint32_t> queue(vertices.getSize(), 0);
+    size_t reached = reachable(start, NO_VERTEX, false, visited.getData(), queue.getData());
+    if (visit) {
+        for (size_t k = 0; k < reached; ++k) {
+            visit(vertices[queue[k]]);
+        }
+    }
+}
+
+template<typename T>
+void CSRGraph<T>::depthFirstSearch(const T& start_vertex, void (*visit)(const T&)) const {
+    uint32_t start = requireId(start_vertex);
+    DynamicArray<bool> visited(vertices.getSize(), false);
+    DynamicArray<std::pair<uint32_t, size_t>> calls;   // vertex and the next edge to follow
+    visited[start] = true;
+    if (visit) {
+        visit(vertices[start]);
+    }
+    calls.push_back(std::make_pair(start, offsets[start]));
+    
+    while (!calls.empty()) {
+        uint32_t vertex = calls.back().first;
+        size_t position = calls.back().second;
+        if (position == offsets[vertex + 1]) {
+            calls.pop_back();
+            continue;
+        }
+        calls.back().second = position + 1;
+        uint32_t next = targets[position];
+        if (!visited[next]) {
+            visited[next] = true;
+            if (visit) {
+                visit(vertices[next]);
+            }
+            calls.push_back(std::make_pair(next, offsets[next]));
+        }
+    }
+}
+
+template<typename T>
+bool CSRGraph<T>::hasPath(const T& source, const T& destination) const {
+    const uint32_t* from = ids.find(source);
+    const uint32_t* to = ids.find(destination);
+    if (!from || !to) {
+        return false;
+    }
+    DynamicArray<bool> visited(vertices.getSize(), false);
+    DynamicArray<uint32_t> queue(vertices.getSize(), 0);
+    reachable(*from, *to, false, visited.getData(), queue.getData());
+    return visited[*to];
+}
+
+template<typename T>
+void CSRGraph<T>::dijkstra(const T& source, double*& distances, T*& predecessors) const {
+    uint32_t start = requireId(source);
+    size_t n = vertices.getSize();
+    DynamicArray<uint32_t> previous(n, 0);
+    distances = new double[n];
+    shortestPaths(start, NO_VERTEX, distances, previous.getData());
+    
+    // As in Graph, the source and unreached vertices are their own predecessor
+    predecessors = new T[n];
+    for (size_t v = 0; v < n; ++v) {
+        predecessors[v] = vertices[previous[v] == NO_VERTEX ? v : previous[v]];
+    }
+}
+
+template<typename T>
+double CSRGraph<T>::shortestPathDistance(const T& source, const T& destination) const {
+    uint32_t start = requireId(source);
+    uint32_t target = requireId(destination);
+    DynamicArray<double> distances(vertices.getSize(), 0.0);
+    DynamicArray<uint32_t> previous(vertices.getSize(), 0);
+    shortestPaths(start, target, distances.getData(), previous.getData());
+    return distances[target];
+}
+
+template<typename T>
+size_t CSRGraph<T>::countConnectedComponents() const {
+    size_t n = vertices.getSize();
+    DynamicArray<bool> visited(n, false);
+    DynamicArray<uint32_t> queue(n, 0);
+    size_t component_count = 0;
+    for (size_t v = 0; v < n; ++v) {
+        if (!visited[v]) {
+            reachable(static_cast<uint32_t>(v), NO_VERTEX, true, visited.getData(), queue.getData());
+            ++component_count;
+        }
+    }
+    return component_count;
+}
+
+template<typename T>
+bool CSRGraph<T>::isConnected() const {
+    return countConnectedComponents() <= 1;
+}
+
+template<typename T>
+T* CSRGraph<T>::topologicalSort(size_t& sorted_count) const {
+    sorted_count = 0;
+    size_t n = vertices.getSize();
+    if (!is_directed || n == 0) {
+        return nullptr;
+    }
+    
+    // Kahn's algorithm on the in-degrees the transpose already holds
+    DynamicArray<size_t> in_degree(n, 0);
+    DynamicArray<uint32_t> order(n, 0);
+    size_t tail = 0;
+    for (size_t v = 0; v < n; ++v) {
+        in_degree[v] = in_offsets[v + 1] - in_offsets[v];
+        if (in_degree[v] == 0) {
+            order[tail++] = static_cast<uint32_t>(v);
+        }
+    }
+    for (size_t head = 0; head < tail; ++head) {
+        uint32_t vertex = order[head];
+        for (size_t k = offsets[vertex]; k < offsets[vertex + 1]; ++k) {
+            if (--in_degree[targets[k]] == 0) {
+                order[tail++] = targets[k];
+            }
+        }
+    }
+    if (tail < n) {
+        return nullptr;
+    }
+    
+    T* result = new T[n];
+    for (size_t k = 0; k < n; ++k) {
+        result[k] = vertices[order[k]];
+    }
+    sorted_count = n;
+    return result;
+}
+
+template<typename T>
+void CSRGraph<T>::parallelBreadthFirstSearch(const T& start_vertex, uint32_t*& distances, uint32_t*& parents,
+                                             ThreadPool& pool) const {
+    uint32_t start = requireId(start_vertex);
+    size_t n = vertices.getSize();
+    size_t words = (n + 63) / 64;
+    std::unique_ptr<uint32_t[]> hops(new uint32_t[n]);
+    std::unique_ptr<uint32_t[]> tree(new uint32_t[n]);
+    std::unique_ptr<std::atomic<uint64_t>[]> visited(new std::atomic<uint64_t>[words]);
+    size_t tasks = bfsTaskCount(words, pool);
+    pool.parallelFor(tasks, [&](size_t task) {
+        for (size_t w = words * task / tasks; w < words * (task + 1) / tasks; ++w) {
+            visited[w].store(0, std::memory_order_relaxed);
+            size_t end = std::min(n, w * 64 + 64);
+            std::fill(hops.get() + w * 64, hops.get() + end, NO_VERTEX);
+            std::fill(tree.get() + w * 64, tree.get() + end, NO_VERTEX);
+        }
+    });
+    hops[start] = 0;
+    tree[start] = start;
+    visited[start / 64].store(uint64_t(1) << (start % 64), std::memory_order_relaxed);
+    
+    // The frontier is a queue of ids while going top-down and a bitmap while going
+    // bottom-up; edge counts are out-edges, as stored in offsets
+    DynamicArray<uint32_t> queue;
+    DynamicArray<uint32_t> next_queue;
+    DynamicArray<uint64_t> frontier;
+    DynamicArray<uint64_t> next_frontier;
+    queue.push_back(start);
+    size_t frontier_size = 1;
+    size_t frontier_edges = getOutDegree(start);
+    size_t unexplored_edges = targets.getSize() - frontier_edges;
+    bool bottom_up = false;
+    bool shrinking = false;
+    
+    while (frontier_size > 0) {
+        if (!bottom_up && frontier_edges > unexplored_edges / BFS_ALPHA) {
+            frontier.assign(words, 0);
+            next_frontier.assign(words, 0);
+            for (size_t i = 0; i < queue.getSize(); ++i) {
+                frontier[queue[i] / 64] |= uint64_t(1) << (queue[i] % 64);
+            }
+            bottom_up = true;
+        } else if (bottom_up && shrinking && frontier_size < n / BFS_BETA) {
+            queue.clear();
+            for (size_t w = 0; w < words; ++w) {
+                for (size_t bit = 0; bit < 64 && (frontier[w] >> bit) != 0; ++bit) {
+                    if ((frontier[w] >> bit) & 1) {
+                        queue.push_back(static_cast<uint32_t>(w * 64 + bit));
+                    }
+                }
+            }
+            bottom_up = false;
+        }
+        
+        size_t previous_size = frontier_size;
+        if (bottom_up) {
+            frontier_size = bottomUpStep(frontier, next_frontier, visited.get(), hops.get(), tree.get(),
+                                         frontier_edges, pool);
+            frontier.swap(next_frontier);
+        } else {
+            frontier_edges = topDownStep(queue, next_queue, visited.get(), hops.get(), tree.get(), pool);
+            queue.swap(next_queue);
+            frontier_size = queue.getSize();
+        }
+        unexplored_edges -= frontier_edges;
+        shrinking = frontier_size < previous_size;
+    }
+    
+    distances = hops.release();
+    parents = tree.release();
+}
+
+#endif
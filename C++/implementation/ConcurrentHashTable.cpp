@@ -0,0 +1,287 @@
+//==================== CONCURRENT HASH TABLE IMPLEMENTATION ====================
+#ifndef CONCURRENT_HASH_TABLE_CPP
+#define CONCURRENT_HASH_TABLE_CPP
+
+#include <stdexcept>
+#include <functional>
+#include <thread>
+#include <utility>
+#include "../header/ConcurrentHashTable.h"
+#include "HashTable.cpp"
+
+//==================== SHARD ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+std::atomic<typename ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::ReaderSlot*>
+ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::reader_slots(nullptr);
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::Shard::Shard() : table(), write_lock(), sequence(0) {}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::WriteGuard::WriteGuard(Shard& s) : shard(s), drained(false) {
+    shard.write_lock.lock();
+    // Odd from here on: new readers back off, readers already probing fail validation
+    shard.sequence.fetch_add(1);
+    // Keeps the table writes below from becoming visible before the odd sequence
+    std::atomic_thread_fence(std::memory_order_release);
+    if (!OPTIMISTIC_READS) {
+        waitForReaders();
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::WriteGuard::~WriteGuard() {
+    shard.sequence.fetch_add(1, std::memory_order_release);
+    shard.write_lock.unlock();
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::WriteGuard::waitForReaders() {
+    // The odd sequence and a reader's slot are both seq_cst, so a reader this
+    // scan misses has not loaded the sequence yet and will see it odd
+    if (drained) {
+        return;
+    }
+    for (ReaderSlot* slot = reader_slots.load(); slot; slot = slot->next) {
+        while (slot->shard.load() == &shard) {
+            std::this_thread::yield();
+        }
+    }
+    drained = true;
+}
+
+//==================== PRIVATE HELPER FUNCTIONS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::hash(const Key& key) const {
+    return Hash{}(key);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::Shard& ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::shardFor(const Key& key) {
+    // Take the top bits of a multiplicative mix so the shard choice is
+    // independent of the low bits each shard uses for its home slot
+    uint64_t mixed = static_cast<uint64_t>(hash(key)) * 0x9E3779B97F4A7C15ULL;
+    return shards[shard_bits ? static_cast<size_t>(mixed >> (64 - shard_bits)) : 0];
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+const typename ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::Shard& ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::shardFor(const Key& key) const {
+    uint64_t mixed = static_cast<uint64_t>(hash(key)) * 0x9E3779B97F4A7C15ULL;
+    return shards[shard_bits ? static_cast<size_t>(mixed >> (64 - shard_bits)) : 0];
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename Function>
+auto ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::readShard(const Shard& shard, Function&& function) const
+    -> decltype(function(shard.table)) {
+    // Clears the slot on every way out, so a throwing Hash cannot stall writers
+    struct Announce {
+        ReaderSlot& slot;
+        Announce(ReaderSlot& s, const Shard& shard) : slot(s) { slot.shard.store(&shard); }
+        ~Announce() { slot.shard.store(nullptr, std::memory_order_release); }
+    };
+    
+    ReaderSlot& slot = readerSlot();
+    while (true) {
+        {
+            Announce announce(slot, shard);
+            uint64_t before = shard.sequence.load();
+            if ((before & 1) == 0) {
+                // The probe may race a writer; the result only counts if the
+                // sequence did not move while it ran. Reading through a racing
+                // write is only sound because OPTIMISTIC_READS requires trivially
+                // copyable Key and Value; otherwise writers drain readers first
+                auto result = function(shard.table);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (shard.sequence.load(std::memory_order_relaxed) == before) {
+                    return result;
+                }
+            }
+        }
+        while (shard.sequence.load(std::memory_order_acquire) & 1) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::ReaderSlot& ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::readerSlot() {
+    struct Owner {
+        ReaderSlot* slot;
+        Owner() : slot(claimReaderSlot()) {}
+        ~Owner() { slot->in_use.store(false, std::memory_order_release); }
+    };
+    static thread_local Owner owner;
+    return *owner.slot;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::ReaderSlot* ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::claimReaderSlot() {
+    // Reuse a slot left by an exited thread, otherwise push a new one
+    for (ReaderSlot* slot = reader_slots.load(); slot; slot = slot->next) {
+        bool expected = false;
+        if (!slot->in_use.load(std::memory_order_relaxed) && slot->in_use.compare_exchange_strong(expected, true)) {
+            return slot;
+        }
+    }
+    ReaderSlot* slot = new ReaderSlot();
+    slot->shard.store(nullptr, std::memory_order_relaxed);
+    slot->in_use.store(true, std::memory_order_relaxed);
+    slot->next = reader_slots.load();
+    while (!reader_slots.compare_exchange_weak(slot->next, slot)) {
+    }
+    return slot;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::destroyShards() {
+    delete[] shards;
+    shards = nullptr;
+}
+
+//==================== CONSTRUCTORS AND DESTRUCTOR ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::ConcurrentHashTable(size_t shard_count, size_t initial_capacity, ProbingMode mode)
+    : shards(nullptr), shard_count(1), shard_bits(0) {
+    while (this->shard_count < shard_count) {
+        this->shard_count <<= 1;
+        ++shard_bits;
+    }
+    
+    shards = new Shard[this->shard_count];
+    for (size_t i = 0; i < this->shard_count; ++i) {
+        shards[i].table = HashTable<Key, Value, Sizing, Hash, KeyEqual>(initial_capacity, mode);
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::~ConcurrentHashTable() {
+    destroyShards();
+}
+
+//==================== MODIFIERS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::insert(const Key& key, const Value& value) {
+    Shard& shard = shardFor(key);
+    WriteGuard guard(shard);
+    if (shard.table.insertMayResize(key)) {
+        guard.waitForReaders();
+    }
+    shard.table.insert(key, value);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::insert(Key&& key, Value&& value) {
+    Shard& shard = shardFor(key);
+    WriteGuard guard(shard);
+    if (shard.table.insertMayResize(key)) {
+        guard.waitForReaders();
+    }
+    shard.table.insert(std::move(key), std::move(value));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename... Args>
+void ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::emplace(const Key& key, Args&&... args) {
+    Shard& shard = shardFor(key);
+    WriteGuard guard(shard);
+    if (shard.table.insertMayResize(key)) {
+        guard.waitForReaders();
+    }
+    shard.table.emplace(key, std::forward<Args>(args)...);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename Function>
+bool ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::update(const Key& key, Function&& function) {
+    // Read-modify-write under the shard's write lock
+    Shard& shard = shardFor(key);
+    WriteGuard guard(shard);
+    Value* value = shard.table.find(key);
+    if (!value) {
+        return false;
+    }
+    function(*value);
+    return true;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::remove(const Key& key) {
+    Shard& shard = shardFor(key);
+    WriteGuard guard(shard);
+    return shard.table.remove(key);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::clear() {
+    for (size_t i = 0; i < shard_count; ++i) {
+        WriteGuard guard(shards[i]);
+        shards[i].table.clear();
+    }
+}
+
+//==================== LOOKUP OPERATIONS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::find(const Key& key, Value& result) const {
+    // Copy into a local first: an attempt that fails validation must not reach result
+    Value copy = Value();
+    bool found = readShard(shardFor(key), [&](const HashTable<Key, Value, Sizing, Hash, KeyEqual>& table) {
+        const Value* value = table.find(key);
+        if (value) {
+            copy = *value;
+        }
+        return value != nullptr;
+    });
+    if (found) {
+        result = std::move(copy);
+    }
+    return found;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::contains(const Key& key) const {
+    return readShard(shardFor(key), [&](const HashTable<Key, Value, Sizing, Hash, KeyEqual>& table) {
+        return table.contains(key);
+    });
+}
+
+//==================== CAPACITY ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::getSize() const {
+    // Each shard is read consistently, the total is a snapshot across shards
+    size_t total = 0;
+    for (size_t i = 0; i < shard_count; ++i) {
+        total += readShard(shards[i], [](const HashTable<Key, Value, Sizing, Hash, KeyEqual>& table) {
+            return table.getSize();
+        });
+    }
+    return total;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::empty() const {
+    return getSize() == 0;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::getShardCount() const {
+    return shard_count;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void ConcurrentHashTable<Key, Value, Sizing, Hash, KeyEqual>::reserve(size_t min_capacity) {
+    size_t per_shard = min_capacity / shard_count + 1;
+    for (size_t i = 0; i < shard_count; ++i) {
+        WriteGuard guard(shards[i]);
+        guard.waitForReaders();
+        shards[i].table.reserve(per_shard);
+    }
+}
+
+#endif
@@ -0,0 +1,339 @@
+//==================== DIJKSTRA ENGINE IMPLEMENTATION ====================
+#ifndef DIJKSTRA_ENGINE_CPP
+#define DIJKSTRA_ENGINE_CPP
+
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "../header/DijkstraEngine.h"
+#include "vectors.cpp"
+#include "CSRGraph.cpp"
+#include "IndexedHeap.cpp"
+
+//==================== PRIVATE HELPER FUNCTIONS ====================
+
+template<typename T>
+double ZeroHeuristic::operator()(const T&, const T&) const {
+    return 0.0;
+}
+
+template<typename T, typename Heap, typename Heuristic>
+bool DijkstraEngine<T, Heap, Heuristic>::isReached(uint32_t id) const {
+    return stamps[id] >= 2 * query;
+}
+
+template<typename T, typename Heap, typename Heuristic>
+void DijkstraEngine<T, Heap, Heuristic>::beginQuery() {
+    // Stamps from earlier queries all read as unreached; they are only
+    // cleared when the counter is about to overflow
+    if (++query > UINT32_MAX / 2) {
+        stamps.assign(stamps.getSize(), 0);
+        query = 1;
+    }
+    heap.clear();
+    settled_count = 0;
+}
+
+template<typename T, typename Heap, typename Heuristic>
+void DijkstraEngine<T, Heap, Heuristic>::checkWeights(const CSRGraph<T>& snapshot, bool whole_numbers) {
+    // Done once per engine instead of on every relaxation
+    for (size_t v = 0; v < snapshot.getVertexCount(); ++v) {
+        size_t degree = 0;
+        const double* weights = snapshot.getWeights(static_cast<uint32_t>(v), degree);
+        for (size_t k = 0; k < degree; ++k) {
+            if (!(weights[k] >= 0.0)) {
+                throw std::invalid_argument("Dijkstra needs non-negative edge weights");
+            }
+            if (whole_numbers && weights[k] != std::floor(weights[k])) {
+                throw std::invalid_argument("Radix heap needs whole-number edge weights");
+            }
+        }
+    }
+}
+
+//==================== CONSTRUCTORS ====================
+
+template<typename T, typename Heap, typename Heuristic>
+DijkstraEngine<T, Heap, Heuristic>::DijkstraEngine(const CSRGraph<T>& snapshot, Heuristic heuristic)
+    : graph(&snapshot), heuristic(heuristic), query(1), settled_count(0) {
+    checkWeights(snapshot, Heap::integer_keys);
+    size_t n = snapshot.getVertexCount();
+    distances.resize(n, 0.0);
+    previous.resize(n, 0);
+    stamps.resize(n, 0);      // below 2 * query, so nothing reads as reached yet
+    heap.reset(n);
+}
+
+//==================== SEARCH ====================
+
+template<typename T, typename Heap, typename Heuristic>
+void DijkstraEngine<T, Heap, Heuristic>::search(uint32_t source_id, uint32_t target_id) {
+    size_t n = stamps.getSize();
+    if (source_id >= n || (target_id >= n && target_id != CSRGraph<T>::NO_VERTEX)) {
+        throw std::out_of_range("Vertex not found");
+    }
+    beginQuery();
+    uint32_t reached = 2 * query;
+    uint32_t settled = 2 * query + 1;
+    
+    // Keys are distance plus the heuristic's estimate; without a target, or
+    // with ZeroHeuristic, that is plain Dijkstra
+    const T* goal = target_id == CSRGraph<T>::NO_VERTEX ? nullptr : &graph->getVertex(target_id);
+    auto estimate = [&](uint32_t id) {
+        return goal ? heuristic(graph->getVertex(id), *goal) : 0.0;
+    };
+    distances[source_id] = 0.0;
+    previous[source_id] = CSRGraph<T>::NO_VERTEX;
+    stamps[source_id] = reached;
+    heap.push(source_id, estimate(source_id));
+    
+    while (!heap.empty()) {
+        uint32_t vertex = heap.pop();
+        if (stamps[vertex] == settled) {
+            continue;   // a repeat from a heap without decrease-key
+        }
+        stamps[vertex] = settled;
+        ++settled_count;
+        if (vertex == target_id) {
+            break;
+        }
+        size_t degree = 0;
+        const uint32_t* neighbors = graph->getNeighbors(vertex, degree);
+        const double* weights = graph->getWeights(vertex, degree);
+        for (size_t k = 0; k < degree; ++k) {
+            // A settled neighbor only improves under an inconsistent
+            // heuristic; it is then reopened and queued again
+            uint32_t next = neighbors[k];
+            double candidate = distances[vertex] + weights[k];
+            if (stamps[next] < reached || candidate < distances[next]) {
+                stamps[next] = reached;
+                distances[next] = candidate;
+                previous[next] = vertex;
+                heap.push(next, candidate + estimate(next));
+            }
+        }
+    }
+}
+
+template<typename T, typename Heap, typename Heuristic>
+double DijkstraEngine<T, Heap, Heuristic>::getDistance(uint32_t id) const {
+    return isReached(id) ? distances[id] : std::numeric_limits<double>::infinity();
+}
+
+template<typename T, typename Heap, typename Heuristic>
+uint32_t DijkstraEngine<T, Heap, Heuristic>::getPredecessor(uint32_t id) const {
+    return isReached(id) ? previous[id] : CSRGraph<T>::NO_VERTEX;
+}
+
+template<typename T, typename Heap, typename Heuristic>
+bool DijkstraEngine<T, Heap, Heuristic>::isSettled(uint32_t id) const {
+    return stamps[id] == 2 * query + 1;
+}
+
+template<typename T, typename Heap, typename Heuristic>
+size_t DijkstraEngine<T, Heap, Heuristic>::getSettledCount() const {
+    return settled_count;
+}
+
+template<typename T, typename Heap, typename Heuristic>
+void DijkstraEngine<T, Heap, Heuristic>::getPath(uint32_t target_id, DynamicArray<uint32_t>& path) const {
+    path.clear();
+    if (!isReached(target_id)) {
+        return;
+    }
+    for (uint32_t id = target_id; id != CSRGraph<T>::NO_VERTEX; id = previous[id]) {
+        path.push_back(id);
+    }
+    std::reverse(path.getData(), path.getData() + path.getSize());
+}
+
+//==================== VERTEX QUERIES ====================
+
+template<typename T, typename Heap, typename Heuristic>
+double DijkstraEngine<T, Heap, Heuristic>::shortestPathDistance(const T& source_vertex, const T& destination) {
+    uint32_t target = graph->getId(destination);
+    search(graph->getId(source_vertex), target);
+    return getDistance(target);
+}
+
+template<typename T, typename Heap, typename Heuristic>
+T* DijkstraEngine<T, Heap, Heuristic>::shortestPath(const T& source_vertex, const T& destination, size_t& path_length) {
+    uint32_t target = graph->getId(destination);
+    search(graph->getId(source_vertex), target);
+    DynamicArray<uint32_t> path;
+    getPath(target, path);
+    path_length = path.getSize();
+    if (path_length == 0) {
+        return nullptr;
+    }
+    T* result = new T[path_length];
+    for (size_t k = 0; k < path_length; ++k) {
+        result[k] = graph->getVertex(path[k]);
+    }
+    return result;
+}
+
+template<typename T, typename Heap, typename Heuristic>
+void DijkstraEngine<T, Heap, Heuristic>::dijkstra(const T& source_vertex, double*& distances_out, T*& predecessors) {
+    search(graph->getId(source_vertex));
+    size_t n = graph->getVertexCount();
+    distances_out = new double[n];
+    predecessors = new T[n];
+    
+    // As in Graph, the source and unreached vertices are their own predecessor
+    for (size_t v = 0; v < n; ++v) {
+        uint32_t parent = getPredecessor(static_cast<uint32_t>(v));
+        distances_out[v] = getDistance(static_cast<uint32_t>(v));
+        predecessors[v] = graph->getVertex(parent == CSRGraph<T>::NO_VERTEX ? static_cast<uint32_t>(v) : parent);
+    }
+}
+
+//==================== BIDIRECTIONAL ENGINE ====================
+
+template<typename T, typename Heap>
+void BidirectionalDijkstraEngine<T, Heap>::beginQuery() {
+    if (++query > UINT32_MAX / 2) {
+        forward.stamps.assign(forward.stamps.getSize(), 0);
+        backward.stamps.assign(backward.stamps.getSize(), 0);
+        query = 1;
+    }
+    forward.heap.clear();
+    backward.heap.clear();
+    forward.radius = 0.0;
+    backward.radius = 0.0;
+    meeting = CSRGraph<T>::NO_VERTEX;
+    best = std::numeric_limits<double>::infinity();
+    settled_count = 0;
+}
+
+template<typename T, typename Heap>
+void BidirectionalDijkstraEngine<T, Heap>::start(Side& side, uint32_t vertex) {
+    side.distances[vertex] = 0.0;
+    side.previous[vertex] = CSRGraph<T>::NO_VERTEX;
+    side.stamps[vertex] = 2 * query;
+    side.heap.push(vertex, 0.0);
+}
+
+template<typename T, typename Heap>
+void BidirectionalDijkstraEngine<T, Heap>::settleNext(Side& side, const Side& other, bool reverse) {
+    uint32_t reached = 2 * query;
+    uint32_t settled = 2 * query + 1;
+    uint32_t vertex = side.heap.pop();
+    if (side.stamps[vertex] == settled) {
+        return;     // a repeat from a heap without decrease-key
+    }
+    side.stamps[vertex] = settled;
+    side.radius = side.distances[vertex];
+    ++settled_count;
+    
+    size_t degree = 0;
+    const uint32_t* neighbors = reverse ? graph->getInNeighbors(vertex, degree) : graph->getNeighbors(vertex, degree);
+    const double* weights = reverse ? graph->getInWeights(vertex, degree) : graph->getWeights(vertex, degree);
+    for (size_t k = 0; k < degree; ++k) {
+        uint32_t next = neighbors[k];
+        double candidate = side.distances[vertex] + weights[k];
+        if (side.stamps[next] < reached || candidate < side.distances[next]) {
+            side.stamps[next] = reached;
+            side.distances[next] = candidate;
+            side.previous[next] = vertex;
+            side.heap.push(next, candidate);
+        }
+        // Whichever side reaches a vertex second joins the two trees there
+        if (other.stamps[next] >= reached && side.distances[next] + other.distances[next] < best) {
+            best = side.distances[next] + other.distances[next];
+            meeting = next;
+        }
+    }
+}
+
+template<typename T, typename Heap>
+BidirectionalDijkstraEngine<T, Heap>::BidirectionalDijkstraEngine(const CSRGraph<T>& snapshot)
+    : graph(&snapshot), query(1), meeting(CSRGraph<T>::NO_VERTEX),
+      best(std::numeric_limits<double>::infinity()), settled_count(0) {
+    DijkstraEngine<T, Heap>::checkWeights(snapshot, Heap::integer_keys);
+    size_t n = snapshot.getVertexCount();
+    Side* sides[] = {&forward, &backward};
+    for (Side* side : sides) {
+        side->distances.resize(n, 0.0);
+        side->previous.resize(n, 0);
+        side->stamps.resize(n, 0);
+        side->heap.reset(n);
+        side->radius = 0.0;
+    }
+}
+
+template<typename T, typename Heap>
+void BidirectionalDijkstraEngine<T, Heap>::search(uint32_t source_id, uint32_t target_id) {
+    size_t n = forward.stamps.getSize();
+    if (source_id >= n || target_id >= n) {
+        throw std::out_of_range("Vertex not found");
+    }
+    beginQuery();
+    start(forward, source_id);
+    start(backward, target_id);
+    if (source_id == target_id) {
+        best = 0.0;
+        meeting = source_id;
+        return;
+    }
+    
+    // Any shorter path would have to leave both settled balls, so it costs at
+    // least the two radii together; an exhausted side has seen every meeting
+    while (!forward.heap.empty() && !backward.heap.empty() && forward.radius + backward.radius < best) {
+        if (forward.heap.getSize() <= backward.heap.getSize()) {
+            settleNext(forward, backward, false);
+        } else {
+            settleNext(backward, forward, true);
+        }
+    }
+}
+
+template<typename T, typename Heap>
+double BidirectionalDijkstraEngine<T, Heap>::getDistance() const {
+    return best;
+}
+
+template<typename T, typename Heap>
+size_t BidirectionalDijkstraEngine<T, Heap>::getSettledCount() const {
+    return settled_count;
+}
+
+template<typename T, typename Heap>
+void BidirectionalDijkstraEngine<T, Heap>::getPath(DynamicArray<uint32_t>& path) const {
+    path.clear();
+    if (meeting == CSRGraph<T>::NO_VERTEX) {
+        return;
+    }
+    for (uint32_t id = meeting; id != CSRGraph<T>::NO_VERTEX; id = forward.previous[id]) {
+        path.push_back(id);
+    }
+    std::reverse(path.getData(), path.getData() + path.getSize());
+    for (uint32_t id = backward.previous[meeting]; id != CSRGraph<T>::NO_VERTEX; id = backward.previous[id]) {
+        path.push_back(id);
+    }
+}
+
+template<typename T, typename Heap>
+double BidirectionalDijkstraEngine<T, Heap>::shortestPathDistance(const T& source_vertex, const T& destination) {
+    search(graph->getId(source_vertex), graph->getId(destination));
+    return best;
+}
+
+template<typename T, typename Heap>
+T* BidirectionalDijkstraEngine<T, Heap>::shortestPath(const T& source_vertex, const T& destination, size_t& path_length) {
+    search(graph->getId(source_vertex), graph->getId(destination));
+    DynamicArray<uint32_t> path;
+    getPath(path);
+    path_length = path.getSize();
+    if (path_length == 0) {
+        return nullptr;
+    }
+    T* result = new T[path_length];
+    for (size_t k = 0; k < path_length; ++k) {
+        result[k] = graph->getVertex(path[k]);
+    }
+    return result;
+}
+
+#endif
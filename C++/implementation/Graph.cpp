@@ -1,237 +1,2348 @@
-//==================== GRAPH (ADJACENCY LIST) ====================
-#ifndef GRAPH_H
-#define GRAPH_H
+//==================== GRAPH IMPLEMENTATION ====================
+#ifndef GRAPH_CPP
+#define GRAPH_CPP
+
+#include <stdexcept>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+#include "../header/Graph.h"
+#include "vectors.cpp"
+#include "CSRGraph.cpp"
+
+//==================== EDGE CONSTRUCTORS ====================
+
+template<typename T>
+Graph<T>::Edge::Edge() : destination(), weight(1.0), next(nullptr) {}
+
+template<typename T>
+Graph<T>::Edge::Edge(const T& dest) : destination(dest), weight(1.0), next(nullptr) {}
+
+template<typename T>
+Graph<T>::Edge::Edge(const T& dest, double w) : destination(dest), weight(w), next(nullptr) {}
+
+template<typename T>
+Graph<T>::Edge::Edge(T&& dest) : destination(std::move(dest)), weight(1.0), next(nullptr) {}
+
+template<typename T>
+Graph<T>::Edge::Edge(T&& dest, double w) : destination(std::move(dest)), weight(w), next(nullptr) {}
+
+// Copies describe the same edge but are not linked into any list
+template<typename T>
+Graph<T>::Edge::Edge(const Edge& other) : destination(other.destination), weight(other.weight), next(nullptr) {}
+
+template<typename T>
+Graph<T>::Edge::Edge(Edge&& other) noexcept : destination(std::move(other.destination)), weight(other.weight), next(nullptr) {}
+
+template<typename T>
+typename Graph<T>::Edge& Graph<T>::Edge::operator=(const Edge& other) {
+    destination = other.destination;
+    weight = other.weight;
+    return *this;
+}
+
+template<typename T>
+typename Graph<T>::Edge& Graph<T>::Edge::operator=(Edge&& other) noexcept {
+    destination = std::move(other.destination);
+    weight = other.weight;
+    return *this;
+}
+
+template<typename T>
+Graph<T>::Edge::~Edge() {}
+
+//==================== VERTEX CONSTRUCTORS ====================
+
+template<typename T>
+Graph<T>::Vertex::Vertex()
+    : data(), edge_list(nullptr), visited(false), distance(std::numeric_limits<double>::infinity()), predecessor(),
+      discovery_time(-1), finish_time(-1) {}
+
+template<typename T>
+Graph<T>::Vertex::Vertex(const T& value)
+    : data(value), edge_list(nullptr), visited(false), distance(std::numeric_limits<double>::infinity()), predecessor(value),
+      discovery_time(-1), finish_time(-1) {}
+
+template<typename T>
+Graph<T>::Vertex::Vertex(T&& value)
+    : data(std::move(value)), edge_list(nullptr), visited(false), distance(std::numeric_limits<double>::infinity()), predecessor(data),
+      discovery_time(-1), finish_time(-1) {}
+
+template<typename T>
+Graph<T>::Vertex::Vertex(const Vertex& other)
+    : data(other.data), edge_list(nullptr), visited(other.visited), distance(other.distance), predecessor(other.predecessor),
+      discovery_time(other.discovery_time), finish_time(other.finish_time) {}
+
+template<typename T>
+Graph<T>::Vertex::Vertex(Vertex&& other) noexcept
+    : data(std::move(other.data)), edge_list(other.edge_list), visited(other.visited), distance(other.distance),
+      predecessor(std::move(other.predecessor)), discovery_time(other.discovery_time), finish_time(other.finish_time) {
+    other.edge_list = nullptr;
+}
+
+template<typename T>
+typename Graph<T>::Vertex& Graph<T>::Vertex::operator=(const Vertex& other) {
+    data = other.data;
+    visited = other.visited;
+    distance = other.distance;
+    predecessor = other.predecessor;
+    discovery_time = other.discovery_time;
+    finish_time = other.finish_time;
+    return *this;
+}
+
+template<typename T>
+typename Graph<T>::Vertex& Graph<T>::Vertex::operator=(Vertex&& other) noexcept {
+    if (this != &other) {
+        data = std::move(other.data);
+        edge_list = other.edge_list;
+        visited = other.visited;
+        distance = other.distance;
+        predecessor = std::move(other.predecessor);
+        discovery_time = other.discovery_time;
+        finish_time = other.finish_time;
+        other.edge_list = nullptr;
+    }
+    return *this;
+}
+
+template<typename T>
+Graph<T>::Vertex::~Vertex() {}
+
+//==================== PRIVATE HELPER FUNCTIONS ====================
+
+template<typename T>
+void Graph<T>::reallocateVertices(size_t new_capacity) {
+    Vertex* new_vertices = new Vertex[new_capacity];
+    for (size_t i = 0; i < vertex_count; ++i) {
+        new_vertices[i] = std::move(vertices[i]);
+    }
+    delete[] vertices;
+    vertices = new_vertices;
+    vertex_capacity = new_capacity;
+}
+
+template<typename T>
+size_t Graph<T>::findVertexIndex(const T& vertex) const {
+    const size_t* slot = vertex_index.find(vertex);
+    return slot ? *slot : vertex_count;
+}
+
+template<typename T>
+typename Graph<T>::Vertex* Graph<T>::findVertex(const T& vertex) {
+    size_t index = findVertexIndex(vertex);
+    return index < vertex_count ? &vertices[index] : nullptr;
+}
+
+template<typename T>
+const typename Graph<T>::Vertex* Graph<T>::findVertex(const T& vertex) const {
+    size_t index = findVertexIndex(vertex);
+    return index < vertex_count ? &vertices[index] : nullptr;
+}
 
 template<typename T>
-class Graph {
-private:
-    struct Edge {
-        T destination;
-        double weight;
-        Edge* next;
+typename Graph<T>::Edge* Graph<T>::createEdge(const T& dest) {
+    return new Edge(dest);
+}
+
+template<typename T>
+typename Graph<T>::Edge* Graph<T>::createEdge(const T& dest, double weight) {
+    return new Edge(dest, weight);
+}
+
+template<typename T>
+typename Graph<T>::Edge* Graph<T>::createEdge(T&& dest) {
+    return new Edge(std::move(dest));
+}
+
+template<typename T>
+typename Graph<T>::Edge* Graph<T>::createEdge(T&& dest, double weight) {
+    return new Edge(std::move(dest), weight);
+}
+
+template<typename T>
+void Graph<T>::destroyEdge(Edge* edge) {
+    delete edge;
+}
+
+template<typename T>
+void Graph<T>::destroyEdgeList(Edge* edge_list) {
+    while (edge_list) {
+        Edge* next = edge_list->next;
+        destroyEdge(edge_list);
+        edge_list = next;
+    }
+}
+
+template<typename T>
+typename Graph<T>::Edge* Graph<T>::findEdge(Vertex* vertex, const T& destination) {
+    for (Edge* edge = vertex->edge_list; edge; edge = edge->next) {
+        if (edge->destination == destination) {
+            return edge;
+        }
+    }
+    return nullptr;
+}
+
+template<typename T>
+const typename Graph<T>::Edge* Graph<T>::findEdge(const Vertex* vertex, const T& destination) const {
+    for (const Edge* edge = vertex->edge_list; edge; edge = edge->next) {
+        if (edge->destination == destination) {
+            return edge;
+        }
+    }
+    return nullptr;
+}
+
+template<typename T>
+void Graph<T>::addEdgeToVertex(Vertex* vertex, Edge* edge) {
+    // Appended, so lists keep insertion order
+    Edge** link = &vertex->edge_list;
+    while (*link) {
+        link = &(*link)->next;
+    }
+    *link = edge;
+}
+
+template<typename T>
+bool Graph<T>::removeEdgeFromVertex(Vertex* vertex, const T& destination) {
+    for (Edge** link = &vertex->edge_list; *link; link = &(*link)->next) {
+        if ((*link)->destination == destination) {
+            Edge* edge = *link;
+            *link = edge->next;
+            destroyEdge(edge);
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename T>
+void Graph<T>::copyEdgeList(Edge* source, Edge*& destination) {
+    destination = nullptr;
+    Edge** link = &destination;
+    for (; source; source = source->next) {
+        *link = new Edge(*source);
+        link = &(*link)->next;
+    }
+}
+
+template<typename T>
+void Graph<T>::copyFrom(const Graph& other) {
+    vertex_capacity = other.vertex_capacity;
+    initializeVertices();
+    for (size_t i = 0; i < other.vertex_count; ++i) {
+        vertices[i] = other.vertices[i];
+        copyEdgeList(other.vertices[i].edge_list, vertices[i].edge_list);
+        ++vertex_count;
+    }
+    vertex_index = other.vertex_index;
+    edge_count = other.edge_count;
+    is_directed = other.is_directed;
+    is_weighted = other.is_weighted;
+}
+
+template<typename T>
+void Graph<T>::moveFrom(Graph&& other) {
+    vertices = other.vertices;
+    vertex_count = other.vertex_count;
+    vertex_capacity = other.vertex_capacity;
+    edge_count = other.edge_count;
+    is_directed = other.is_directed;
+    is_weighted = other.is_weighted;
+    vertex_index.swap(other.vertex_index);     // leaves other with a usable empty index
+    
+    other.vertices = nullptr;
+    other.vertex_count = 0;
+    other.vertex_capacity = 0;
+    other.edge_count = 0;
+}
+
+template<typename T>
+void Graph<T>::initializeVertices() {
+    vertices = new Vertex[vertex_capacity];
+    vertex_count = 0;
+    edge_count = 0;
+}
+
+template<typename T>
+void Graph<T>::destroyVertices() {
+    for (size_t i = 0; i < vertex_count; ++i) {
+        destroyEdgeList(vertices[i].edge_list);
+    }
+    delete[] vertices;
+    vertices = nullptr;
+    vertex_count = 0;
+    vertex_capacity = 0;
+    edge_count = 0;
+    vertex_index.clear();
+}
+
+template<typename T>
+void Graph<T>::resetVertexStates() {
+    for (size_t i = 0; i < vertex_count; ++i) {
+        vertices[i].visited = false;
+        vertices[i].distance = std::numeric_limits<double>::infinity();
+        vertices[i].predecessor = vertices[i].data;
+        vertices[i].discovery_time = -1;
+        vertices[i].finish_time = -1;
+    }
+}
+
+template<typename T>
+size_t Graph<T>::requireVertexIndex(const T& vertex) const {
+    size_t index = findVertexIndex(vertex);
+    if (index == vertex_count) {
+        throw std::out_of_range("Vertex not found");
+    }
+    return index;
+}
+
+template<typename T>
+size_t Graph<T>::countEdges(const Edge* edge_list) const {
+    size_t count = 0;
+    for (; edge_list; edge_list = edge_list->next) {
+        ++count;
+    }
+    return count;
+}
+
+template<typename T>
+T* Graph<T>::copyVertexData(const size_t* indices, size_t count) const {
+    if (count == 0) {
+        return nullptr;
+    }
+    T* result = new T[count];
+    for (size_t i = 0; i < count; ++i) {
+        result[i] = vertices[indices[i]].data;
+    }
+    return result;
+}
+
+template<typename T>
+T* Graph<T>::tracePath(const size_t* previous, size_t target, size_t& path_length) const {
+    DynamicArray<size_t> path;
+    for (size_t index = target; index != NO_INDEX; index = previous[index]) {
+        path.push_back(index);
+    }
+    std::reverse(path.getData(), path.getData() + path.getSize());
+    path_length = path.getSize();
+    return copyVertexData(path.getData(), path_length);
+}
+
+template<typename T>
+T* Graph<T>::predecessorPath(size_t target, size_t& path_length) const {
+    path_length = 0;
+    if (vertices[target].distance == std::numeric_limits<double>::infinity()) {
+        return nullptr;
+    }
+    
+    // Only the source and unreached vertices are their own predecessor
+    DynamicArray<size_t> previous(vertex_count, NO_INDEX);
+    for (size_t index = target; !(vertices[index].predecessor == vertices[index].data);) {
+        size_t parent = findVertexIndex(vertices[index].predecessor);
+        previous[index] = parent;
+        index = parent;
+    }
+    return tracePath(previous.getData(), target, path_length);
+}
+
+template<typename T>
+void Graph<T>::indexAdjacency(DynamicArray<size_t>& offsets, DynamicArray<size_t>& neighbors, bool symmetric) const {
+    bool add_reverse = symmetric && is_directed;
+    DynamicArray<size_t> targets;
+    targets.reserve(add_reverse ? edge_count : 2 * edge_count);
+    offsets.assign(vertex_count + 1, 0);
+    for (size_t i = 0; i < vertex_count; ++i) {
+        for (const Edge* edge = vertices[i].edge_list; edge; edge = edge->next) {
+            size_t target = findVertexIndex(edge->destination);
+            targets.push_back(target);
+            ++offsets[i + 1];
+            if (add_reverse) {
+                ++offsets[target + 1];
+            }
+        }
+    }
+    for (size_t i = 0; i < vertex_count; ++i) {
+        offsets[i + 1] += offsets[i];
+    }
+    
+    neighbors.assign(offsets[vertex_count], 0);
+    DynamicArray<size_t> cursor(offsets);
+    size_t position = 0;
+    for (size_t i = 0; i < vertex_count; ++i) {
+        for (const Edge* edge = vertices[i].edge_list; edge; edge = edge->next) {
+            size_t target = targets[position++];
+            neighbors[cursor[i]++] = target;
+            if (add_reverse) {
+                neighbors[cursor[target]++] = i;
+            }
+        }
+    }
+}
+
+template<typename T>
+size_t Graph<T>::componentLabels(size_t* labels) const {
+    DynamicArray<size_t> offsets;
+    DynamicArray<size_t> neighbors;
+    indexAdjacency(offsets, neighbors, true);
+    
+    std::fill(labels, labels + vertex_count, NO_INDEX);
+    DynamicArray<size_t> queue;
+    queue.reserve(vertex_count);
+    size_t component_count = 0;
+    for (size_t root = 0; root < vertex_count; ++root) {
+        if (labels[root] != NO_INDEX) {
+            continue;
+        }
+        labels[root] = component_count;
+        queue.clear();
+        queue.push_back(root);
+        for (size_t head = 0; head < queue.getSize(); ++head) {
+            size_t vertex = queue[head];
+            for (size_t k = offsets[vertex]; k < offsets[vertex + 1]; ++k) {
+                size_t next = neighbors[k];
+                if (labels[next] == NO_INDEX) {
+                    labels[next] = component_count;
+                    queue.push_back(next);
+                }
+            }
+        }
+        ++component_count;
+    }
+    return component_count;
+}
+
+template<typename T>
+T** Graph<T>::groupComponents(const size_t* labels, size_t group_count, size_t*& group_sizes) const {
+    if (group_count == 0) {
+        group_sizes = nullptr;
+        return nullptr;
+    }
+    group_sizes = new size_t[group_count]();
+    for (size_t i = 0; i < vertex_count; ++i) {
+        ++group_sizes[labels[i]];
+    }
+    
+    T** groups = new T*[group_count];
+    DynamicArray<size_t> filled(group_count, 0);
+    for (size_t g = 0; g < group_count; ++g) {
+        groups[g] = group_sizes[g] ? new T[group_sizes[g]] : nullptr;
+    }
+    for (size_t i = 0; i < vertex_count; ++i) {
+        groups[labels[i]][filled[labels[i]]++] = vertices[i].data;
+    }
+    return groups;
+}
+
+template<typename T>
+size_t Graph<T>::findSet(size_t* parents, size_t element) {
+    while (parents[element] != element) {
+        parents[element] = parents[parents[element]];   // path halving
+        element = parents[element];
+    }
+    return element;
+}
+
+//==================== ALGORITHM HELPERS ====================
+
+template<typename T>
+void Graph<T>::dfsHelper(const T& vertex, void (*visit)(const T&)) {
+    size_t start = requireVertexIndex(vertex);
+    resetVertexStates();
+    int time = 0;
+    dfsHelperRecursive(start, visit, time);
+}
+
+template<typename T>
+void Graph<T>::dfsHelperRecursive(size_t vertex_index, void (*visit)(const T&), int& time) {
+    Vertex& current = vertices[vertex_index];
+    current.visited = true;
+    current.discovery_time = time++;
+    if (visit) {
+        visit(current.data);
+    }
+    
+    for (Edge* edge = current.edge_list; edge; edge = edge->next) {
+        size_t next = findVertexIndex(edge->destination);
+        if (!vertices[next].visited) {
+            vertices[next].predecessor = current.data;
+            dfsHelperRecursive(next, visit, time);
+        }
+    }
+    current.finish_time = time++;
+}
+
+template<typename T>
+void Graph<T>::bfsHelper(const T& vertex, void (*visit)(const T&)) {
+    size_t start = requireVertexIndex(vertex);
+    DynamicArray<size_t> queue;
+    vertices[start].visited = true;
+    vertices[start].distance = 0.0;
+    queue.push_back(start);
+    
+    for (size_t head = 0; head < queue.getSize(); ++head) {
+        Vertex& current = vertices[queue[head]];
+        if (visit) {
+            visit(current.data);
+        }
+        for (Edge* edge = current.edge_list; edge; edge = edge->next) {
+            size_t next = findVertexIndex(edge->destination);
+            if (!vertices[next].visited) {
+                vertices[next].visited = true;
+                vertices[next].distance = current.distance + 1.0;
+                vertices[next].predecessor = current.data;
+                queue.push_back(next);
+            }
+        }
+    }
+}
+
+template<typename T>
+bool Graph<T>::hasPathHelper(const T& source, const T& destination) {
+    size_t target = findVertexIndex(destination);
+    if (target == vertex_count || !hasVertex(source)) {
+        return false;
+    }
+    resetVertexStates();
+    bfsHelper(source, nullptr);
+    return vertices[target].visited;
+}
+
+template<typename T>
+void Graph<T>::dijkstraHelper(const T& source, size_t stop) {
+    size_t start = requireVertexIndex(source);
+    resetVertexStates();
+    
+    // Binary heap of (distance, vertex); outdated entries are skipped when popped
+    DynamicArray<std::pair<double, size_t>> heap;
+    std::greater<std::pair<double, size_t>> later;
+    vertices[start].distance = 0.0;
+    heap.push_back(std::make_pair(0.0, start));
+    
+    while (!heap.empty()) {
+        std::pop_heap(heap.getData(), heap.getData() + heap.getSize(), later);
+        size_t index = heap.back().second;
+        heap.pop_back();
+        Vertex& current = vertices[index];
+        if (current.visited) {
+            continue;
+        }
+        current.visited = true;
+        if (index == stop) {
+            break;      // settled, so its distance and predecessor chain are final
+        }
         
-        // Edge constructors to implement
-        Edge();
-        Edge(const T& dest);
-        Edge(const T& dest, double w);
-        Edge(T&& dest);
-        Edge(T&& dest, double w);
-        Edge(const Edge& other);
-        Edge(Edge&& other) noexcept;
-        Edge& operator=(const Edge& other);
-        Edge& operator=(Edge&& other) noexcept;
-        ~Edge();
-    };
+        for (Edge* edge = current.edge_list; edge; edge = edge->next) {
+            if (edge->weight < 0.0) {
+                throw std::invalid_argument("Dijkstra needs non-negative edge weights");
+            }
+            size_t next = findVertexIndex(edge->destination);
+            double candidate = current.distance + edge->weight;
+            if (candidate < vertices[next].distance) {
+                vertices[next].distance = candidate;
+                vertices[next].predecessor = current.data;
+                heap.push_back(std::make_pair(candidate, next));
+                std::push_heap(heap.getData(), heap.getData() + heap.getSize(), later);
+            }
+        }
+    }
+}
+
+template<typename T>
+template<typename Heuristic>
+void Graph<T>::aStarHelper(size_t start, size_t target, Heuristic& heuristic) {
+    resetVertexStates();
+    const T& goal = vertices[target].data;
+    
+    // Same lazy heap as dijkstraHelper, keyed by distance plus estimate. An
+    // admissible but inconsistent estimate can improve a visited vertex, which
+    // is then reopened; the target's distance is exact once it is popped.
+    DynamicArray<std::pair<double, size_t>> heap;
+    std::greater<std::pair<double, size_t>> later;
+    vertices[start].distance = 0.0;
+    heap.push_back(std::make_pair(heuristic(vertices[start].data, goal), start));
     
-    struct Vertex {
-        T data;
-        Edge* edge_list;
-        bool visited;
-        double distance;
-        T predecessor;
-        int discovery_time;
-        int finish_time;
+    while (!heap.empty()) {
+        std::pop_heap(heap.getData(), heap.getData() + heap.getSize(), later);
+        size_t index = heap.back().second;
+        heap.pop_back();
+        Vertex& current = vertices[index];
+        if (current.visited) {
+            continue;
+        }
+        current.visited = true;
+        if (index == target) {
+            break;
+        }
         
-        // Vertex constructors to implement
-        Vertex();
-        Vertex(const T& value);
-        Vertex(T&& value);
-        Vertex(const Vertex& other);
-        Vertex(Vertex&& other) noexcept;
-        Vertex& operator=(const Vertex& other);
-        Vertex& operator=(Vertex&& other) noexcept;
-        ~Vertex();
-    };
+        for (Edge* edge = current.edge_list; edge; edge = edge->next) {
+            if (edge->weight < 0.0) {
+                throw std::invalid_argument("Dijkstra needs non-negative edge weights");
+            }
+            size_t next = findVertexIndex(edge->destination);
+            double candidate = current.distance + edge->weight;
+            if (candidate < vertices[next].distance) {
+                vertices[next].distance = candidate;
+                vertices[next].predecessor = current.data;
+                vertices[next].visited = false;
+                heap.push_back(std::make_pair(candidate + heuristic(vertices[next].data, goal), next));
+                std::push_heap(heap.getData(), heap.getData() + heap.getSize(), later);
+            }
+        }
+    }
+}
+
+template<typename T>
+bool Graph<T>::bellmanFordHelper(const T& source) {
+    size_t start = requireVertexIndex(source);
+    resetVertexStates();
+    vertices[start].distance = 0.0;
+    
+    // One round more than a shortest path can need; a change in that round means a negative cycle
+    for (size_t round = 0; round < vertex_count; ++round) {
+        bool changed = false;
+        for (size_t i = 0; i < vertex_count; ++i) {
+            if (vertices[i].distance == std::numeric_limits<double>::infinity()) {
+                continue;
+            }
+            for (Edge* edge = vertices[i].edge_list; edge; edge = edge->next) {
+                size_t next = findVertexIndex(edge->destination);
+                double candidate = vertices[i].distance + edge->weight;
+                if (candidate < vertices[next].distance) {
+                    vertices[next].distance = candidate;
+                    vertices[next].predecessor = vertices[i].data;
+                    changed = true;
+                }
+            }
+        }
+        if (!changed) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename T>
+void Graph<T>::floydWarshallHelper(double* distances, size_t* predecessors) const {
+    size_t n = vertex_count;
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            distances[i * n + j] = i == j ? 0.0 : std::numeric_limits<double>::infinity();
+            predecessors[i * n + j] = i == j ? i : NO_INDEX;
+        }
+        for (const Edge* edge = vertices[i].edge_list; edge; edge = edge->next) {
+            size_t j = findVertexIndex(edge->destination);
+            if (edge->weight < distances[i * n + j]) {
+                distances[i * n + j] = edge->weight;
+                predecessors[i * n + j] = i;
+            }
+        }
+    }
+    
+    for (size_t k = 0; k < n; ++k) {
+        for (size_t i = 0; i < n; ++i) {
+            double through = distances[i * n + k];
+            if (through == std::numeric_limits<double>::infinity()) {
+                continue;
+            }
+            for (size_t j = 0; j < n; ++j) {
+                double candidate = through + distances[k * n + j];
+                if (candidate < distances[i * n + j]) {
+                    distances[i * n + j] = candidate;
+                    predecessors[i * n + j] = predecessors[k * n + j];
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+bool Graph<T>::topologicalSortHelper(size_t* order) const {
+    if (!is_directed) {
+        return false;
+    }
+    DynamicArray<size_t> offsets;
+    DynamicArray<size_t> neighbors;
+    indexAdjacency(offsets, neighbors, false);
+    
+    // Kahn's algorithm; order doubles as the queue
+    DynamicArray<size_t> in_degree(vertex_count, 0);
+    for (size_t k = 0; k < neighbors.getSize(); ++k) {
+        ++in_degree[neighbors[k]];
+    }
+    size_t tail = 0;
+    for (size_t i = 0; i < vertex_count; ++i) {
+        if (in_degree[i] == 0) {
+            order[tail++] = i;
+        }
+    }
+    for (size_t head = 0; head < tail; ++head) {
+        size_t vertex = order[head];
+        for (size_t k = offsets[vertex]; k < offsets[vertex + 1]; ++k) {
+            if (--in_degree[neighbors[k]] == 0) {
+                order[tail++] = neighbors[k];
+            }
+        }
+    }
+    return tail == vertex_count;
+}
+
+template<typename T>
+size_t Graph<T>::stronglyConnectedComponentsHelper(size_t* labels) const {
+    // Tarjan's algorithm with an explicit call stack of (vertex, next edge)
+    DynamicArray<size_t> order(vertex_count, NO_INDEX);
+    DynamicArray<size_t> low(vertex_count, 0);
+    DynamicArray<bool> on_stack(vertex_count, false);
+    DynamicArray<size_t> stack;
+    DynamicArray<std::pair<size_t, const Edge*>> calls;
+    size_t counter = 0;
+    size_t component_count = 0;
     
-    Vertex* vertices;
-    size_t vertex_count;
-    size_t vertex_capacity;
-    size_t edge_count;
-    bool is_directed;
-    bool is_weighted;
-    
-    // Private helper functions to implement
-    void reallocateVertices(size_t new_capacity);
-    size_t findVertexIndex(const T& vertex) const;
-    Vertex* findVertex(const T& vertex);
-    const Vertex* findVertex(const T& vertex) const;
-    Edge* createEdge(const T& dest);
-    Edge* createEdge(const T& dest, double weight);
-    Edge* createEdge(T&& dest);
-    Edge* createEdge(T&& dest, double weight);
-    void destroyEdge(Edge* edge);
-    void destroyEdgeList(Edge* edge_list);
-    Edge* findEdge(Vertex* vertex, const T& destination);
-    const Edge* findEdge(const Vertex* vertex, const T& destination) const;
-    void addEdgeToVertex(Vertex* vertex, Edge* edge);
-    bool removeEdgeFromVertex(Vertex* vertex, const T& destination);
-    void copyEdgeList(Edge* source, Edge*& destination);
-    void copyFrom(const Graph& other);
-    void moveFrom(Graph&& other);
-    void initializeVertices();
-    void destroyVertices();
-    void resetVertexStates();
-    
-    // Algorithm helpers to implement
-    void dfsHelper(const T& vertex, void (*visit)(const T&));
-    void dfsHelperRecursive(size_t vertex_index, void (*visit)(const T&), int& time);
-    void bfsHelper(const T& vertex, void (*visit)(const T&));
-    bool hasPathHelper(const T& source, const T& destination);
-    void dijkstraHelper(const T& source);
-    void bellmanFordHelper(const T& source);
-    void floydWarshallHelper();
-    bool topologicalSortHelper(T* result);
-    void stronglyConnectedComponentsHelper();
-    double primMSTHelper();
-    double kruskalMSTHelper();
-    
-public:
-    // Constructors and Destructor
-    Graph(bool directed = false, bool weighted = false);
-    Graph(size_t initial_capacity, bool directed = false, bool weighted = false);
-    Graph(const Graph& other);
-    Graph(Graph&& other) noexcept;
-    ~Graph();
-    
-    // Assignment operators
-    Graph& operator=(const Graph& other);
-    Graph& operator=(Graph&& other) noexcept;
-    
-    // Vertex operations
-    void addVertex(const T& vertex);
-    void addVertex(T&& vertex);
-    bool removeVertex(const T& vertex);
-    bool hasVertex(const T& vertex) const;
-    size_t getVertexCount() const;
-    T* getVertices() const;
-    size_t getVertexDegree(const T& vertex) const;
-    size_t getInDegree(const T& vertex) const;
-    size_t getOutDegree(const T& vertex) const;
-    
-    // Edge operations
-    void addEdge(const T& source, const T& destination);
-    void addEdge(const T& source, const T& destination, double weight);
-    void addEdge(T&& source, T&& destination);
-    void addEdge(T&& source, T&& destination, double weight);
-    bool removeEdge(const T& source, const T& destination);
-    bool hasEdge(const T& source, const T& destination) const;
-    double getEdgeWeight(const T& source, const T& destination) const;
-    void setEdgeWeight(const T& source, const T& destination, double weight);
-    size_t getEdgeCount() const;
-    
-    // Graph properties
-    bool isDirected() const;
-    bool isWeighted() const;
-    bool isEmpty() const;
-    void clear();
-    void swap(Graph& other);
-    
-    // Neighbor operations
-    T* getNeighbors(const T& vertex, size_t& neighbor_count) const;
-    T* getInNeighbors(const T& vertex, size_t& neighbor_count) const;
-    T* getOutNeighbors(const T& vertex, size_t& neighbor_count) const;
-    
-    // Graph algorithms - Traversals
-    void depthFirstSearch(const T& start_vertex, void (*visit)(const T&));
-    void breadthFirstSearch(const T& start_vertex, void (*visit)(const T&));
-    void depthFirstTraversal(void (*visit)(const T&));
-    void breadthFirstTraversal(void (*visit)(const T&));
-    
-    // Graph algorithms - Path finding
-    bool hasPath(const T& source, const T& destination);
-    T* shortestPath(const T& source, const T& destination, size_t& path_length);
-    double shortestPathDistance(const T& source, const T& destination);
-    T* longestPath(const T& source, const T& destination, size_t& path_length);
-    T** allShortestPaths(double**& distances);
-    
-    // Graph algorithms - Shortest path algorithms
-    void dijkstra(const T& source, double*& distances, T*& predecessors);
-    bool bellmanFord(const T& source, double*& distances, T*& predecessors);
-    void floydWarshall(double**& distances, T**& predecessors);
-    
-    // Graph algorithms - Connectivity
-    bool isConnected();
-    bool isStronglyConnected();
-    size_t countConnectedComponents();
-    T** getConnectedComponents(size_t*& component_sizes, size_t& component_count);
-    T** getStronglyConnectedComponents(size_t*& component_sizes, size_t& component_count);
-    
-    // Graph algorithms - Cycle detection
-    bool hasCycle();
-    T* findCycle(size_t& cycle_length);
-    
-    // Graph algorithms - Topological sorting
-    bool isDAG();
-    T* topologicalSort(size_t& sorted_count);
-    T** allTopologicalSorts(size_t& sort_count);
-    
-    // Graph algorithms - Minimum spanning tree
-    double minimumSpanningTreePrim(Edge**& mst_edges, size_t& edge_count);
-    double minimumSpanningTreeKruskal(Edge**& mst_edges, size_t& edge_count);
-    
-    // Graph algorithms - Special properties
-    bool isBipartite();
-    T** getBipartitePartitions(size_t*& partition_sizes);
-    bool isPlanar();
-    int chromaticNumber();
-    T* graphColoring(int*& colors);
-    
-    // Vertex Iterator class
-    class VertexIterator {
-    private:
-        Vertex* vertices;
-        size_t vertex_count;
-        size_t current_index;
+    for (size_t root = 0; root < vertex_count; ++root) {
+        if (order[root] != NO_INDEX) {
+            continue;
+        }
+        order[root] = low[root] = counter++;
+        stack.push_back(root);
+        on_stack[root] = true;
+        calls.push_back(std::make_pair(root, static_cast<const Edge*>(vertices[root].edge_list)));
         
-    public:
-        VertexIterator();
-        VertexIterator(Vertex* v, size_t count, size_t index);
-        VertexIterator(const VertexIterator& other);
-        VertexIterator& operator=(const VertexIterator& other);
-        T& operator*();
-        const T& operator*() const;
-        T* operator->();
-        const T* operator->() const;
-        VertexIterator& operator++();
-        VertexIterator operator++(int);
-        bool operator==(const VertexIterator& other) const;
-        bool operator!=(const VertexIterator& other) const;
+        while (!calls.empty()) {
+            size_t vertex = calls.back().first;
+            const Edge* edge = calls.back().second;
+            if (edge) {
+                calls.back().second = edge->next;
+                size_t next = findVertexIndex(edge->destination);
+                if (order[next] == NO_INDEX) {
+                    order[next] = low[next] = counter++;
+                    stack.push_back(next);
+                    on_stack[next] = true;
+                    calls.push_back(std::make_pair(next, static_cast<const Edge*>(vertices[next].edge_list)));
+                } else if (on_stack[next]) {
+                    low[vertex] = std::min(low[vertex], order[next]);
+                }
+                continue;
+            }
+            
+            calls.pop_back();
+            if (!calls.empty()) {
+                size_t parent = calls.back().first;
+                low[parent] = std::min(low[parent], low[vertex]);
+            }
+            if (low[vertex] == order[vertex]) {
+                size_t member;
+                do {
+                    member = stack.back();
+                    stack.pop_back();
+                    on_stack[member] = false;
+                    labels[member] = component_count;
+                } while (member != vertex);
+                ++component_count;
+            }
+        }
+    }
+    return component_count;
+}
+
+template<typename T>
+bool Graph<T>::twoColorHelper(size_t* sides) const {
+    DynamicArray<size_t> offsets;
+    DynamicArray<size_t> neighbors;
+    indexAdjacency(offsets, neighbors, true);
+    
+    std::fill(sides, sides + vertex_count, NO_INDEX);
+    DynamicArray<size_t> queue;
+    queue.reserve(vertex_count);
+    for (size_t root = 0; root < vertex_count; ++root) {
+        if (sides[root] != NO_INDEX) {
+            continue;
+        }
+        sides[root] = 0;
+        queue.clear();
+        queue.push_back(root);
+        for (size_t head = 0; head < queue.getSize(); ++head) {
+            size_t vertex = queue[head];
+            for (size_t k = offsets[vertex]; k < offsets[vertex + 1]; ++k) {
+                size_t next = neighbors[k];
+                if (sides[next] == NO_INDEX) {
+                    sides[next] = 1 - sides[vertex];
+                    queue.push_back(next);
+                } else if (sides[next] == sides[vertex]) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+template<typename T>
+bool Graph<T>::colorableHelper(const DynamicArray<size_t>& offsets, const DynamicArray<size_t>& neighbors,
+                               const size_t* order, int color_count) const {
+    // Backtracking over the vertices in order. A vertex may open at most one
+    // color beyond those already used, which skips relabelled duplicates.
+    DynamicArray<int> colors(vertex_count, -1);
+    DynamicArray<int> highest(vertex_count + 1, -1);   // highest color among the first p vertices
+    size_t position = 0;
+    while (position < vertex_count) {
+        size_t vertex = order[position];
+        int limit = std::min(color_count, highest[position] + 2);
+        int color = colors[vertex] + 1;
+        for (; color < limit; ++color) {
+            bool clash = false;
+            for (size_t k = offsets[vertex]; k < offsets[vertex + 1] && !clash; ++k) {
+                clash = colors[neighbors[k]] == color;
+            }
+            if (!clash) {
+                break;
+            }
+        }
+        
+        if (color < limit) {
+            colors[vertex] = color;
+            highest[position + 1] = std::max(highest[position], color);
+            ++position;
+        } else {
+            colors[vertex] = -1;
+            if (position == 0) {
+                return false;
+            }
+            --position;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+double Graph<T>::primMSTHelper(Edge** mst_edges, size_t& mst_edge_count) const {
+    DynamicArray<bool> in_tree(vertex_count, false);
+    DynamicArray<Edge*> candidates;
+    DynamicArray<std::pair<double, size_t>> heap;   // weight and position in candidates
+    std::greater<std::pair<double, size_t>> later;
+    double total = 0.0;
+    mst_edge_count = 0;
+    
+    auto addCandidates = [&](size_t index) {
+        for (Edge* edge = vertices[index].edge_list; edge; edge = edge->next) {
+            heap.push_back(std::make_pair(edge->weight, candidates.getSize()));
+            candidates.push_back(edge);
+            std::push_heap(heap.getData(), heap.getData() + heap.getSize(), later);
+        }
     };
     
-    // Edge Iterator class
-    class EdgeIterator {
-    private:
-        Vertex* vertices;
-        size_t vertex_count;
-        size_t current_vertex;
-        Edge* current_edge;
+    // Restarting from every vertex not yet reached gives a spanning forest
+    for (size_t root = 0; root < vertex_count; ++root) {
+        if (in_tree[root]) {
+            continue;
+        }
+        in_tree[root] = true;
+        addCandidates(root);
+        while (!heap.empty()) {
+            std::pop_heap(heap.getData(), heap.getData() + heap.getSize(), later);
+            Edge* edge = candidates[heap.back().second];
+            heap.pop_back();
+            size_t next = findVertexIndex(edge->destination);
+            if (in_tree[next]) {
+                continue;
+            }
+            in_tree[next] = true;
+            total += edge->weight;
+            mst_edges[mst_edge_count++] = edge;
+            addCandidates(next);
+        }
+    }
+    return total;
+}
+
+template<typename T>
+double Graph<T>::kruskalMSTHelper(Edge** mst_edges, size_t& mst_edge_count) const {
+    // Each undirected edge once, from its lower-indexed end
+    DynamicArray<std::pair<size_t, Edge*>> candidates;
+    DynamicArray<std::pair<double, size_t>> by_weight;
+    for (size_t i = 0; i < vertex_count; ++i) {
+        for (Edge* edge = vertices[i].edge_list; edge; edge = edge->next) {
+            if (i < findVertexIndex(edge->destination)) {
+                by_weight.push_back(std::make_pair(edge->weight, candidates.getSize()));
+                candidates.push_back(std::make_pair(i, edge));
+            }
+        }
+    }
+    std::sort(by_weight.getData(), by_weight.getData() + by_weight.getSize());
+    
+    DynamicArray<size_t> parents(vertex_count, 0);
+    for (size_t i = 0; i < vertex_count; ++i) {
+        parents[i] = i;
+    }
+    double total = 0.0;
+    mst_edge_count = 0;
+    for (size_t k = 0; k < by_weight.getSize(); ++k) {
+        const std::pair<size_t, Edge*>& candidate = candidates[by_weight[k].second];
+        size_t from = findSet(parents.getData(), candidate.first);
+        size_t to = findSet(parents.getData(), findVertexIndex(candidate.second->destination));
+        if (from != to) {
+            parents[from] = to;
+            total += candidate.second->weight;
+            mst_edges[mst_edge_count++] = candidate.second;
+        }
+    }
+    return total;
+}
+
+template<typename T>
+bool Graph<T>::isPlanarBlock(size_t vertex_total, const DynamicArray<size_t>& block_edges) {
+    // Demoucron-Malgrange-Pertuiset on one biconnected block: embed a cycle,
+    // then repeatedly route a path through some fragment (a part not embedded
+    // yet) across a face holding all of the fragment's attachment vertices,
+    // taking fragments that fit a single face first. Faces are vertex cycles.
+    size_t n = vertex_total;
+    size_t m = block_edges.getSize() / 2;
+    DynamicArray<size_t> offsets(n + 1, 0);
+    DynamicArray<size_t> adjacent(2 * m, 0);
+    DynamicArray<size_t> incident(2 * m, 0);
+    for (size_t e = 0; e < m; ++e) {
+        ++offsets[block_edges[2 * e] + 1];
+        ++offsets[block_edges[2 * e + 1] + 1];
+    }
+    for (size_t v = 0; v < n; ++v) {
+        offsets[v + 1] += offsets[v];
+    }
+    DynamicArray<size_t> cursor(offsets);
+    for (size_t e = 0; e < m; ++e) {
+        size_t a = block_edges[2 * e];
+        size_t b = block_edges[2 * e + 1];
+        adjacent[cursor[a]] = b;
+        incident[cursor[a]++] = e;
+        adjacent[cursor[b]] = a;
+        incident[cursor[b]++] = e;
+    }
+    
+    DynamicArray<bool> vertex_embedded(n, false);
+    DynamicArray<bool> edge_embedded(m, false);
+    size_t embedded_edges = 0;
+    
+    // The first back edge of a depth-first search closes the starting cycle
+    DynamicArray<size_t> cycle;
+    {
+        DynamicArray<int> state(n, 0);
+        DynamicArray<size_t> parent(n, NO_INDEX);
+        DynamicArray<size_t> parent_edge(n, NO_INDEX);
+        DynamicArray<std::pair<size_t, size_t>> calls;
+        state[0] = 1;
+        calls.push_back(std::make_pair(size_t(0), offsets[0]));
+        while (cycle.empty() && !calls.empty()) {
+            size_t vertex = calls.back().first;
+            size_t position = calls.back().second;
+            if (position == offsets[vertex + 1]) {
+                state[vertex] = 2;
+                calls.pop_back();
+                continue;
+            }
+            calls.back().second = position + 1;
+            size_t next = adjacent[position];
+            size_t edge = incident[position];
+            if (edge == parent_edge[vertex]) {
+                continue;
+            }
+            if (state[next] == 0) {
+                state[next] = 1;
+                parent[next] = vertex;
+                parent_edge[next] = edge;
+                calls.push_back(std::make_pair(next, offsets[next]));
+            } else if (state[next] == 1) {
+                for (size_t u = vertex; u != next; u = parent[u]) {
+                    cycle.push_back(u);
+                    edge_embedded[parent_edge[u]] = true;
+                }
+                cycle.push_back(next);
+                edge_embedded[edge] = true;
+            }
+        }
+    }
+    if (cycle.empty()) {
+        return true;
+    }
+    for (size_t k = 0; k < cycle.getSize(); ++k) {
+        vertex_embedded[cycle[k]] = true;
+    }
+    embedded_edges = cycle.getSize();
+    DynamicArray<DynamicArray<size_t>> faces;
+    faces.push_back(cycle);
+    faces.push_back(cycle);
+    
+    DynamicArray<size_t> fragment_of(n, NO_INDEX);
+    DynamicArray<size_t> seen(n, NO_INDEX);
+    DynamicArray<size_t> face_mark(n, NO_INDEX);
+    DynamicArray<size_t> previous(n, NO_INDEX);
+    DynamicArray<size_t> previous_edge(n, NO_INDEX);
+    size_t stamp = 0;
+    while (embedded_edges < m) {
+        // Fragments: loose edges between embedded vertices, and connected pieces
+        // of unembedded vertices; attachments are listed per fragment
+        DynamicArray<size_t> fragment_edge;         // NO_INDEX for pieces
+        DynamicArray<size_t> attach_offsets;
+        DynamicArray<size_t> attachments;
+        attach_offsets.push_back(0);
+        for (size_t e = 0; e < m; ++e) {
+            size_t a = block_edges[2 * e];
+            size_t b = block_edges[2 * e + 1];
+            if (!edge_embedded[e] && vertex_embedded[a] && vertex_embedded[b]) {
+                fragment_edge.push_back(e);
+                attachments.push_back(a);
+                attachments.push_back(b);
+                attach_offsets.push_back(attachments.getSize());
+            }
+        }
+        fragment_of.assign(n, NO_INDEX);
+        DynamicArray<size_t> queue;
+        for (size_t root = 0; root < n; ++root) {
+            if (vertex_embedded[root] || fragment_of[root] != NO_INDEX) {
+                continue;
+            }
+            size_t id = fragment_edge.getSize();
+            fragment_edge.push_back(NO_INDEX);
+            fragment_of[root] = id;
+            queue.clear();
+            queue.push_back(root);
+            for (size_t head = 0; head < queue.getSize(); ++head) {
+                size_t vertex = queue[head];
+                for (size_t k = offsets[vertex]; k < offsets[vertex + 1]; ++k) {
+                    size_t next = adjacent[k];
+                    if (vertex_embedded[next]) {
+                        if (seen[next] != id) {
+                            seen[next] = id;
+                            attachments.push_back(next);
+                        }
+                    } else if (fragment_of[next] == NO_INDEX) {
+                        fragment_of[next] = id;
+                        queue.push_back(next);
+                    }
+                }
+            }
+            attach_offsets.push_back(attachments.getSize());
+        }
+        seen.assign(n, NO_INDEX);
+        
+        size_t fragment_count = fragment_edge.getSize();
+        DynamicArray<size_t> fit_count(fragment_count, 0);
+        DynamicArray<size_t> fit_face(fragment_count, NO_INDEX);
+        for (size_t f = 0; f < faces.getSize(); ++f) {
+            ++stamp;
+            for (size_t k = 0; k < faces[f].getSize(); ++k) {
+                face_mark[faces[f][k]] = stamp;
+            }
+            for (size_t g = 0; g < fragment_count; ++g) {
+                bool fits = true;
+                for (size_t k = attach_offsets[g]; k < attach_offsets[g + 1] && fits; ++k) {
+                    fits = face_mark[attachments[k]] == stamp;
+                }
+                if (fits && fit_count[g]++ == 0) {
+                    fit_face[g] = f;
+                }
+            }
+        }
+        size_t chosen = NO_INDEX;
+        for (size_t g = 0; g < fragment_count; ++g) {
+            if (fit_count[g] == 0) {
+                return false;
+            }
+            if (fit_count[g] == 1 && chosen == NO_INDEX) {
+                chosen = g;
+            }
+        }
+        if (chosen == NO_INDEX) {
+            chosen = 0;
+        }
         
-        void findNextEdge();
+        // A path through the fragment between two different attachments
+        DynamicArray<size_t> path;
+        DynamicArray<size_t> path_edges;
+        size_t start = attachments[attach_offsets[chosen]];
+        if (fragment_edge[chosen] != NO_INDEX) {
+            path.push_back(start);
+            path.push_back(attachments[attach_offsets[chosen] + 1]);
+            path_edges.push_back(fragment_edge[chosen]);
+        } else {
+            size_t entry = NO_INDEX;
+            size_t entry_edge = NO_INDEX;
+            for (size_t k = offsets[start]; k < offsets[start + 1] && entry == NO_INDEX; ++k) {
+                if (!vertex_embedded[adjacent[k]] && fragment_of[adjacent[k]] == chosen) {
+                    entry = adjacent[k];
+                    entry_edge = incident[k];
+                }
+            }
+            size_t last = NO_INDEX;
+            size_t exit = NO_INDEX;
+            size_t exit_edge = NO_INDEX;
+            queue.clear();
+            queue.push_back(entry);
+            previous[entry] = NO_INDEX;
+            seen[entry] = 0;
+            for (size_t head = 0; head < queue.getSize() && exit == NO_INDEX; ++head) {
+                size_t vertex = queue[head];
+                for (size_t k = offsets[vertex]; k < offsets[vertex + 1]; ++k) {
+                    size_t next = adjacent[k];
+                    if (vertex_embedded[next]) {
+                        if (next != start) {
+                            last = vertex;
+                            exit = next;
+                            exit_edge = incident[k];
+                            break;
+                        }
+                    } else if (seen[next] == NO_INDEX) {
+                        seen[next] = 0;
+                        previous[next] = vertex;
+                        previous_edge[next] = incident[k];
+                        queue.push_back(next);
+                    }
+                }
+            }
+            for (size_t k = 0; k < queue.getSize(); ++k) {
+                seen[queue[k]] = NO_INDEX;
+            }
+            
+            path.push_back(exit);
+            path_edges.push_back(exit_edge);
+            for (size_t vertex = last; vertex != NO_INDEX; vertex = previous[vertex]) {
+                path.push_back(vertex);
+                path_edges.push_back(vertex == entry ? entry_edge : previous_edge[vertex]);
+            }
+            path.push_back(start);
+            std::reverse(path.getData(), path.getData() + path.getSize());
+        }
         
-    public:
-        EdgeIterator();
-        EdgeIterator(Vertex* v, size_t count, size_t vertex_idx, Edge* edge);
-        EdgeIterator(const EdgeIterator& other);
-        EdgeIterator& operator=(const EdgeIterator& other);
-        Edge& operator*();
-        const Edge& operator*() const;
-        Edge* operator->();
-        const Edge* operator->() const;
-        EdgeIterator& operator++();
-        EdgeIterator operator++(int);
-        bool operator==(const EdgeIterator& other) const;
-        bool operator!=(const EdgeIterator& other) const;
+        // The path splits its face in two
+        DynamicArray<size_t> boundary = faces[fit_face[chosen]];
+        size_t length = boundary.getSize();
+        size_t from = boundary.find(path[0]);
+        size_t to = boundary.find(path.back());
+        DynamicArray<size_t> first;
+        DynamicArray<size_t> second;
+        for (size_t k = from; ; k = (k + 1) % length) {
+            first.push_back(boundary[k]);
+            if (k == to) {
+                break;
+            }
+        }
+        for (size_t k = path.getSize() - 1; k-- > 1;) {
+            first.push_back(path[k]);
+        }
+        for (size_t k = to; ; k = (k + 1) % length) {
+            second.push_back(boundary[k]);
+            if (k == from) {
+                break;
+            }
+        }
+        for (size_t k = 1; k + 1 < path.getSize(); ++k) {
+            second.push_back(path[k]);
+        }
+        faces[fit_face[chosen]] = first;
+        faces.push_back(second);
+        
+        for (size_t k = 0; k < path.getSize(); ++k) {
+            vertex_embedded[path[k]] = true;
+        }
+        for (size_t k = 0; k < path_edges.getSize(); ++k) {
+            edge_embedded[path_edges[k]] = true;
+        }
+        embedded_edges += path_edges.getSize();
+    }
+    return true;
+}
+
+//==================== CONSTRUCTORS AND DESTRUCTOR ====================
+
+template<typename T>
+Graph<T>::Graph(bool directed, bool weighted)
+    : vertices(nullptr), vertex_count(0), vertex_capacity(DEFAULT_CAPACITY), edge_count(0), is_directed(directed), is_weighted(weighted),
+      vertex_index(DEFAULT_CAPACITY, ProbingMode::Group) {
+    initializeVertices();
+}
+
+template<typename T>
+Graph<T>::Graph(size_t initial_capacity, bool directed, bool weighted)
+    : vertices(nullptr), vertex_count(0), vertex_capacity(initial_capacity), edge_count(0), is_directed(directed), is_weighted(weighted),
+      vertex_index(DEFAULT_CAPACITY, ProbingMode::Group) {
+    vertex_index.reserve(initial_capacity);
+    initializeVertices();
+}
+
+template<typename T>
+Graph<T>::Graph(const Graph& other)
+    : vertices(nullptr), vertex_count(0), vertex_capacity(0), edge_count(0), is_directed(other.is_directed), is_weighted(other.is_weighted),
+      vertex_index(DEFAULT_CAPACITY, ProbingMode::Group) {
+    copyFrom(other);
+}
+
+template<typename T>
+Graph<T>::Graph(Graph&& other) noexcept
+    : vertices(nullptr), vertex_count(0), vertex_capacity(0), edge_count(0), is_directed(other.is_directed), is_weighted(other.is_weighted),
+      vertex_index(DEFAULT_CAPACITY, ProbingMode::Group) {
+    moveFrom(std::move(other));
+}
+
+template<typename T>
+Graph<T>::~Graph() {
+    destroyVertices();
+}
+
+//==================== ASSIGNMENT OPERATORS ====================
+
+template<typename T>
+Graph<T>& Graph<T>::operator=(const Graph& other) {
+    if (this != &other) {
+        Graph copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+template<typename T>
+Graph<T>& Graph<T>::operator=(Graph&& other) noexcept {
+    if (this != &other) {
+        destroyVertices();
+        moveFrom(std::move(other));
+    }
+    return *this;
+}
+
+//==================== VERTEX OPERATIONS ====================
+
+template<typename T>
+void Graph<T>::addVertex(const T& vertex) {
+    if (findVertexIndex(vertex) != vertex_count) {
+        return;
+    }
+    if (vertex_count == vertex_capacity) {
+        reallocateVertices(std::max(DEFAULT_CAPACITY, vertex_capacity * 2));
+    }
+    vertices[vertex_count] = Vertex(vertex);
+    vertex_index.insert(vertices[vertex_count].data, vertex_count);
+    ++vertex_count;
+}
+
+template<typename T>
+void Graph<T>::addVertex(T&& vertex) {
+    if (findVertexIndex(vertex) != vertex_count) {
+        return;
+    }
+    if (vertex_count == vertex_capacity) {
+        reallocateVertices(std::max(DEFAULT_CAPACITY, vertex_capacity * 2));
+    }
+    vertices[vertex_count] = Vertex(std::move(vertex));
+    vertex_index.insert(vertices[vertex_count].data, vertex_count);
+    ++vertex_count;
+}
+
+template<typename T>
+bool Graph<T>::removeVertex(const T& vertex) {
+    size_t index = findVertexIndex(vertex);
+    if (index == vertex_count) {
+        return false;
+    }
+    
+    // Its own list holds every undirected edge it has; directed in-edges are counted as they go
+    edge_count -= countEdges(vertices[index].edge_list);
+    destroyEdgeList(vertices[index].edge_list);
+    vertices[index].edge_list = nullptr;
+    for (size_t i = 0; i < vertex_count; ++i) {
+        if (i != index && removeEdgeFromVertex(&vertices[i], vertex) && is_directed) {
+            --edge_count;
+        }
+    }
+    
+    // Later vertices move down one slot, keeping insertion order
+    vertex_index.remove(vertex);
+    for (size_t i = index; i + 1 < vertex_count; ++i) {
+        vertices[i] = std::move(vertices[i + 1]);
+        vertex_index[vertices[i].data] = i;
+    }
+    --vertex_count;
+    vertices[vertex_count] = Vertex();
+    return true;
+}
+
+template<typename T>
+bool Graph<T>::hasVertex(const T& vertex) const {
+    return findVertexIndex(vertex) != vertex_count;
+}
+
+template<typename T>
+size_t Graph<T>::getVertexCount() const {
+    return vertex_count;
+}
+
+template<typename T>
+T* Graph<T>::getVertices() const {
+    if (vertex_count == 0) {
+        return nullptr;
+    }
+    T* result = new T[vertex_count];
+    for (size_t i = 0; i < vertex_count; ++i) {
+        result[i] = vertices[i].data;
+    }
+    return result;
+}
+
+template<typename T>
+size_t Graph<T>::getVertexDegree(const T& vertex) const {
+    size_t out_degree = getOutDegree(vertex);
+    return is_directed ? out_degree + getInDegree(vertex) : out_degree;
+}
+
+template<typename T>
+size_t Graph<T>::getInDegree(const T& vertex) const {
+    size_t index = requireVertexIndex(vertex);
+    if (!is_directed) {
+        return countEdges(vertices[index].edge_list);
+    }
+    size_t degree = 0;
+    for (size_t i = 0; i < vertex_count; ++i) {
+        if (findEdge(&vertices[i], vertex)) {
+            ++degree;
+        }
+    }
+    return degree;
+}
+
+template<typename T>
+size_t Graph<T>::getOutDegree(const T& vertex) const {
+    return countEdges(vertices[requireVertexIndex(vertex)].edge_list);
+}
+
+//==================== EDGE OPERATIONS ====================
+
+template<typename T>
+void Graph<T>::addEdge(const T& source, const T& destination) {
+    addEdge(source, destination, 1.0);
+}
+
+template<typename T>
+void Graph<T>::addEdge(const T& source, const T& destination, double weight) {
+    // Missing endpoints are added; an existing edge only takes the new weight
+    addVertex(source);
+    addVertex(destination);
+    size_t from = findVertexIndex(source);
+    size_t to = findVertexIndex(destination);
+    bool mirrored = !is_directed && from != to;
+    
+    Edge* existing = findEdge(&vertices[from], destination);
+    if (existing) {
+        existing->weight = weight;
+        if (mirrored) {
+            findEdge(&vertices[to], source)->weight = weight;
+        }
+        return;
+    }
+    addEdgeToVertex(&vertices[from], createEdge(destination, weight));
+    if (mirrored) {
+        addEdgeToVertex(&vertices[to], createEdge(source, weight));
+    }
+    ++edge_count;
+}
+
+template<typename T>
+void Graph<T>::addEdge(T&& source, T&& destination) {
+    addEdge(static_cast<const T&>(source), static_cast<const T&>(destination), 1.0);
+}
+
+template<typename T>
+void Graph<T>::addEdge(T&& source, T&& destination, double weight) {
+    addEdge(static_cast<const T&>(source), static_cast<const T&>(destination), weight);
+}
+
+template<typename T>
+bool Graph<T>::removeEdge(const T& source, const T& destination) {
+    size_t from = findVertexIndex(source);
+    size_t to = findVertexIndex(destination);
+    if (from == vertex_count || to == vertex_count || !removeEdgeFromVertex(&vertices[from], destination)) {
+        return false;
+    }
+    if (!is_directed && from != to) {
+        removeEdgeFromVertex(&vertices[to], source);
+    }
+    --edge_count;
+    return true;
+}
+
+template<typename T>
+bool Graph<T>::hasEdge(const T& source, const T& destination) const {
+    const Vertex* from = findVertex(source);
+    return from && findEdge(from, destination);
+}
+
+template<typename T>
+double Graph<T>::getEdgeWeight(const T& source, const T& destination) const {
+    const Vertex* from = findVertex(source);
+    const Edge* edge = from ? findEdge(from, destination) : nullptr;
+    if (!edge) {
+        throw std::out_of_range("Edge not found");
+    }
+    return edge->weight;
+}
+
+template<typename T>
+void Graph<T>::setEdgeWeight(const T& source, const T& destination, double weight) {
+    Vertex* from = findVertex(source);
+    Edge* edge = from ? findEdge(from, destination) : nullptr;
+    if (!edge) {
+        throw std::out_of_range("Edge not found");
+    }
+    edge->weight = weight;
+    if (!is_directed) {
+        findEdge(findVertex(destination), source)->weight = weight;
+    }
+}
+
+template<typename T>
+size_t Graph<T>::getEdgeCount() const {
+    return edge_count;
+}
+
+//==================== GRAPH PROPERTIES ====================
+
+template<typename T>
+bool Graph<T>::isDirected() const {
+    return is_directed;
+}
+
+template<typename T>
+bool Graph<T>::isWeighted() const {
+    return is_weighted;
+}
+
+template<typename T>
+bool Graph<T>::isEmpty() const {
+    return vertex_count == 0;
+}
+
+template<typename T>
+void Graph<T>::clear() {
+    for (size_t i = 0; i < vertex_count; ++i) {
+        destroyEdgeList(vertices[i].edge_list);
+        vertices[i] = Vertex();
+    }
+    vertex_count = 0;
+    edge_count = 0;
+    vertex_index.clear();
+}
+
+template<typename T>
+void Graph<T>::swap(Graph& other) {
+    std::swap(vertices, other.vertices);
+    std::swap(vertex_count, other.vertex_count);
+    std::swap(vertex_capacity, other.vertex_capacity);
+    std::swap(edge_count, other.edge_count);
+    std::swap(is_directed, other.is_directed);
+    std::swap(is_weighted, other.is_weighted);
+    vertex_index.swap(other.vertex_index);
+}
+
+//==================== CSR SNAPSHOT ====================
+
+template<typename T>
+CSRGraph<T> Graph<T>::freeze() const {
+    if (vertex_count >= CSRGraph<T>::NO_VERTEX) {
+        throw std::length_error("Graph has too many vertices for 32-bit ids");
+    }
+    CSRGraph<T> frozen(is_directed, is_weighted);
+    frozen.vertices.reserve(vertex_count);
+    frozen.ids.reserve(vertex_count);
+    for (size_t i = 0; i < vertex_count; ++i) {
+        frozen.vertices.push_back(vertices[i].data);
+        frozen.ids.insert(vertices[i].data, static_cast<uint32_t>(i));
+    }
+    
+    frozen.offsets.assign(vertex_count + 1, 0);
+    for (size_t i = 0; i < vertex_count; ++i) {
+        frozen.offsets[i + 1] = frozen.offsets[i] + countEdges(vertices[i].edge_list);
+    }
+    frozen.targets.resize(frozen.offsets[vertex_count]);
+    frozen.weights.resize(frozen.offsets[vertex_count]);
+    
+    // Rows sorted by target id, resolved through the snapshot's own id table
+    DynamicArray<std::pair<uint32_t, double>> row;
+    for (size_t i = 0; i < vertex_count; ++i) {
+        row.clear();
+        for (const Edge* edge = vertices[i].edge_list; edge; edge = edge->next) {
+            row.push_back(std::make_pair(*frozen.ids.find(edge->destination), edge->weight));
+        }
+        std::sort(row.getData(), row.getData() + row.getSize());
+        size_t base = frozen.offsets[i];
+        for (size_t k = 0; k < row.getSize(); ++k) {
+            frozen.targets[base + k] = row[k].first;
+            frozen.weights[base + k] = row[k].second;
+        }
+    }
+    frozen.edge_count = edge_count;
+    if (is_directed) {
+        frozen.buildTranspose();
+    }
+    return frozen;
+}
+
+//==================== NEIGHBOR OPERATIONS ====================
+
+template<typename T>
+T* Graph<T>::getNeighbors(const T& vertex, size_t& neighbor_count) const {
+    if (!is_directed) {
+        return getOutNeighbors(vertex, neighbor_count);
+    }
+    
+    // Out-neighbors, then in-neighbors that are not also out-neighbors
+    size_t index = requireVertexIndex(vertex);
+    DynamicArray<bool> listed(vertex_count, false);
+    DynamicArray<size_t> neighbors;
+    for (const Edge* edge = vertices[index].edge_list; edge; edge = edge->next) {
+        size_t next = findVertexIndex(edge->destination);
+        listed[next] = true;
+        neighbors.push_back(next);
+    }
+    for (size_t i = 0; i < vertex_count; ++i) {
+        if (!listed[i] && findEdge(&vertices[i], vertex)) {
+            neighbors.push_back(i);
+        }
+    }
+    neighbor_count = neighbors.getSize();
+    return copyVertexData(neighbors.getData(), neighbor_count);
+}
+
+template<typename T>
+T* Graph<T>::getInNeighbors(const T& vertex, size_t& neighbor_count) const {
+    if (!is_directed) {
+        return getOutNeighbors(vertex, neighbor_count);
+    }
+    requireVertexIndex(vertex);
+    DynamicArray<size_t> neighbors;
+    for (size_t i = 0; i < vertex_count; ++i) {
+        if (findEdge(&vertices[i], vertex)) {
+            neighbors.push_back(i);
+        }
+    }
+    neighbor_count = neighbors.getSize();
+    return copyVertexData(neighbors.getData(), neighbor_count);
+}
+
+template<typename T>
+T* Graph<T>::getOutNeighbors(const T& vertex, size_t& neighbor_count) const {
+    const Edge* edge_list = vertices[requireVertexIndex(vertex)].edge_list;
+    neighbor_count = countEdges(edge_list);
+    if (neighbor_count == 0) {
+        return nullptr;
+    }
+    T* result = new T[neighbor_count];
+    size_t i = 0;
+    for (const Edge* edge = edge_list; edge; edge = edge->next) {
+        result[i++] = edge->destination;
+    }
+    return result;
+}
+
+//==================== TRAVERSALS ====================
+
+template<typename T>
+void Graph<T>::depthFirstSearch(const T& start_vertex, void (*visit)(const T&)) {
+    dfsHelper(start_vertex, visit);
+}
+
+template<typename T>
+void Graph<T>::breadthFirstSearch(const T& start_vertex, void (*visit)(const T&)) {
+    requireVertexIndex(start_vertex);
+    resetVertexStates();
+    bfsHelper(start_vertex, visit);
+}
+
+template<typename T>
+void Graph<T>::depthFirstTraversal(void (*visit)(const T&)) {
+    resetVertexStates();
+    int time = 0;
+    for (size_t i = 0; i < vertex_count; ++i) {
+        if (!vertices[i].visited) {
+            dfsHelperRecursive(i, visit, time);
+        }
+    }
+}
+
+template<typename T>
+void Graph<T>::breadthFirstTraversal(void (*visit)(const T&)) {
+    resetVertexStates();
+    for (size_t i = 0; i < vertex_count; ++i) {
+        if (!vertices[i].visited) {
+            bfsHelper(vertices[i].data, visit);
+        }
+    }
+}
+
+template<typename T>
+void Graph<T>::parallelBreadthFirstSearch(const T& start_vertex, double*& distances, T*& predecessors) const {
+    requireVertexIndex(start_vertex);
+    CSRGraph<T> frozen = freeze();
+    uint32_t* hops = nullptr;
+    uint32_t* parents = nullptr;
+    frozen.parallelBreadthFirstSearch(start_vertex, hops, parents);
+    
+    // Snapshot ids are the vertex slots; unreached vertices are their own predecessor
+    distances = new double[vertex_count];
+    predecessors = new T[vertex_count];
+    for (size_t i = 0; i < vertex_count; ++i) {
+        bool reached = hops[i] != CSRGraph<T>::NO_VERTEX;
+        distances[i] = reached ? hops[i] : std::numeric_limits<double>::infinity();
+        predecessors[i] = vertices[reached ? parents[i] : i].data;
+    }
+    delete[] hops;
+    delete[] parents;
+}
+
+//==================== PATH FINDING ====================
+
+template<typename T>
+bool Graph<T>::hasPath(const T& source, const T& destination) {
+    return hasPathHelper(source, destination);
+}
+
+template<typename T>
+T* Graph<T>::shortestPath(const T& source, const T& destination, size_t& path_length) {
+    size_t target = requireVertexIndex(destination);
+    dijkstraHelper(source, target);
+    return predecessorPath(target, path_length);
+}
+
+template<typename T>
+template<typename Heuristic>
+T* Graph<T>::shortestPath(const T& source, const T& destination, size_t& path_length, Heuristic heuristic) {
+    size_t target = requireVertexIndex(destination);
+    aStarHelper(requireVertexIndex(source), target, heuristic);
+    return predecessorPath(target, path_length);
+}
+
+template<typename T>
+double Graph<T>::shortestPathDistance(const T& source, const T& destination) {
+    size_t target = requireVertexIndex(destination);
+    dijkstraHelper(source, target);
+    return vertices[target].distance;
+}
+
+template<typename T>
+T* Graph<T>::longestPath(const T& source, const T& destination, size_t& path_length) {
+    size_t start = requireVertexIndex(source);
+    size_t target = requireVertexIndex(destination);
+    DynamicArray<size_t> order(vertex_count, 0);
+    if (!topologicalSortHelper(order.getData())) {
+        throw std::logic_error("Longest path needs a directed acyclic graph");
+    }
+    
+    // Heaviest distances relaxed in topological order
+    DynamicArray<double> best(vertex_count, -std::numeric_limits<double>::infinity());
+    DynamicArray<size_t> previous(vertex_count, NO_INDEX);
+    best[start] = 0.0;
+    for (size_t k = 0; k < vertex_count; ++k) {
+        size_t vertex = order[k];
+        if (best[vertex] == -std::numeric_limits<double>::infinity()) {
+            continue;
+        }
+        for (const Edge* edge = vertices[vertex].edge_list; edge; edge = edge->next) {
+            size_t next = findVertexIndex(edge->destination);
+            if (best[vertex] + edge->weight > best[next]) {
+                best[next] = best[vertex] + edge->weight;
+                previous[next] = vertex;
+            }
+        }
+    }
+    
+    path_length = 0;
+    if (best[target] == -std::numeric_limits<double>::infinity()) {
+        return nullptr;
+    }
+    return tracePath(previous.getData(), target, path_length);
+}
+
+template<typename T>
+T** Graph<T>::allShortestPaths(double**& distances) {
+    T** predecessors = nullptr;
+    floydWarshall(distances, predecessors);
+    return predecessors;
+}
+
+//==================== SHORTEST PATH ALGORITHMS ====================
+
+template<typename T>
+void Graph<T>::dijkstra(const T& source, double*& distances, T*& predecessors) {
+    dijkstraHelper(source, NO_INDEX);
+    distances = new double[vertex_count];
+    predecessors = new T[vertex_count];
+    for (size_t i = 0; i < vertex_count; ++i) {
+        distances[i] = vertices[i].distance;
+        predecessors[i] = vertices[i].predecessor;
+    }
+}
+
+template<typename T>
+bool Graph<T>::bellmanFord(const T& source, double*& distances, T*& predecessors) {
+    bool no_negative_cycle = bellmanFordHelper(source);
+    distances = new double[vertex_count];
+    predecessors = new T[vertex_count];
+    for (size_t i = 0; i < vertex_count; ++i) {
+        distances[i] = vertices[i].distance;
+        predecessors[i] = vertices[i].predecessor;
+    }
+    return no_negative_cycle;
+}
+
+template<typename T>
+void Graph<T>::floydWarshall(double**& distances, T**& predecessors) {
+    size_t n = vertex_count;
+    distances = nullptr;
+    predecessors = nullptr;
+    if (n == 0) {
+        return;
+    }
+    DynamicArray<double> flat_distances(n * n, 0.0);
+    DynamicArray<size_t> flat_predecessors(n * n, 0);
+    floydWarshallHelper(flat_distances.getData(), flat_predecessors.getData());
+    for (size_t i = 0; i < n; ++i) {
+        if (flat_distances[i * n + i] < 0.0) {
+            throw std::runtime_error("Graph has a negative cycle");
+        }
+    }
+    
+    // Unreachable pairs report the destination as its own predecessor
+    distances = new double*[n];
+    predecessors = new T*[n];
+    for (size_t i = 0; i < n; ++i) {
+        distances[i] = new double[n];
+        predecessors[i] = new T[n];
+        for (size_t j = 0; j < n; ++j) {
+            size_t parent = flat_predecessors[i * n + j];
+            distances[i][j] = flat_distances[i * n + j];
+            predecessors[i][j] = vertices[parent == NO_INDEX ? j : parent].data;
+        }
+    }
+}
+
+//==================== CONNECTIVITY ====================
+
+template<typename T>
+bool Graph<T>::isConnected() {
+    return countConnectedComponents() <= 1;
+}
+
+template<typename T>
+bool Graph<T>::isStronglyConnected() {
+    DynamicArray<size_t> labels(vertex_count, 0);
+    return stronglyConnectedComponentsHelper(labels.getData()) <= 1;
+}
+
+template<typename T>
+size_t Graph<T>::countConnectedComponents() {
+    DynamicArray<size_t> labels(vertex_count, 0);
+    return componentLabels(labels.getData());
+}
+
+template<typename T>
+T** Graph<T>::getConnectedComponents(size_t*& component_sizes, size_t& component_count) {
+    DynamicArray<size_t> labels(vertex_count, 0);
+    component_count = componentLabels(labels.getData());
+    return groupComponents(labels.getData(), component_count, component_sizes);
+}
+
+template<typename T>
+T** Graph<T>::getStronglyConnectedComponents(size_t*& component_sizes, size_t& component_count) {
+    DynamicArray<size_t> labels(vertex_count, 0);
+    component_count = stronglyConnectedComponentsHelper(labels.getData());
+    return groupComponents(labels.getData(), component_count, component_sizes);
+}
+
+//==================== CYCLE DETECTION ====================
+
+template<typename T>
+bool Graph<T>::hasCycle() {
+    if (is_directed) {
+        DynamicArray<size_t> order(vertex_count, 0);
+        return !topologicalSortHelper(order.getData());
+    }
+    // Without parallel edges a forest has exactly vertices - components edges
+    for (size_t i = 0; i < vertex_count; ++i) {
+        if (findEdge(&vertices[i], vertices[i].data)) {
+            return true;
+        }
+    }
+    return edge_count > vertex_count - countConnectedComponents();
+}
+
+template<typename T>
+T* Graph<T>::findCycle(size_t& cycle_length) {
+    // Depth-first search; an edge back to a vertex still on the stack closes a
+    // cycle (for undirected graphs, other than the edge to the DFS parent)
+    DynamicArray<int> state(vertex_count, 0);
+    DynamicArray<size_t> parent(vertex_count, NO_INDEX);
+    DynamicArray<std::pair<size_t, const Edge*>> calls;
+    cycle_length = 0;
+    
+    for (size_t root = 0; root < vertex_count; ++root) {
+        if (state[root] != 0) {
+            continue;
+        }
+        state[root] = 1;
+        calls.push_back(std::make_pair(root, static_cast<const Edge*>(vertices[root].edge_list)));
+        while (!calls.empty()) {
+            size_t vertex = calls.back().first;
+            const Edge* edge = calls.back().second;
+            if (!edge) {
+                state[vertex] = 2;
+                calls.pop_back();
+                continue;
+            }
+            calls.back().second = edge->next;
+            size_t next = findVertexIndex(edge->destination);
+            if (state[next] == 0) {
+                state[next] = 1;
+                parent[next] = vertex;
+                calls.push_back(std::make_pair(next, static_cast<const Edge*>(vertices[next].edge_list)));
+            } else if (state[next] == 1 && (is_directed || next != parent[vertex])) {
+                DynamicArray<size_t> cycle;
+                for (size_t u = vertex; ; u = parent[u]) {
+                    cycle.push_back(u);
+                    if (u == next) {
+                        break;
+                    }
+                }
+                std::reverse(cycle.getData(), cycle.getData() + cycle.getSize());
+                cycle_length = cycle.getSize();
+                return copyVertexData(cycle.getData(), cycle_length);
+            }
+        }
+    }
+    return nullptr;
+}
+
+//==================== TOPOLOGICAL SORTING ====================
+
+template<typename T>
+bool Graph<T>::isDAG() {
+    return is_directed && !hasCycle();
+}
+
+template<typename T>
+T* Graph<T>::topologicalSort(size_t& sorted_count) {
+    DynamicArray<size_t> order(vertex_count, 0);
+    if (!topologicalSortHelper(order.getData())) {
+        sorted_count = 0;
+        return nullptr;
+    }
+    sorted_count = vertex_count;
+    return copyVertexData(order.getData(), vertex_count);
+}
+
+template<typename T>
+T** Graph<T>::allTopologicalSorts(size_t& sort_count) {
+    sort_count = 0;
+    if (!is_directed || vertex_count == 0) {
+        return nullptr;
+    }
+    DynamicArray<size_t> offsets;
+    DynamicArray<size_t> neighbors;
+    indexAdjacency(offsets, neighbors, false);
+    DynamicArray<size_t> in_degree(vertex_count, 0);
+    for (size_t k = 0; k < neighbors.getSize(); ++k) {
+        ++in_degree[neighbors[k]];
+    }
+    
+    // Backtracking: next_try[d] is the first vertex still to try at depth d
+    DynamicArray<bool> used(vertex_count, false);
+    DynamicArray<size_t> chosen(vertex_count, 0);
+    DynamicArray<size_t> next_try(vertex_count + 1, 0);
+    DynamicArray<T*> sorts;
+    auto release = [&](size_t vertex) {
+        used[vertex] = false;
+        for (size_t k = offsets[vertex]; k < offsets[vertex + 1]; ++k) {
+            ++in_degree[neighbors[k]];
+        }
     };
+    size_t depth = 0;
+    while (true) {
+        if (depth == vertex_count) {
+            sorts.push_back(copyVertexData(chosen.getData(), vertex_count));
+            release(chosen[--depth]);
+            continue;
+        }
+        size_t candidate = next_try[depth];
+        while (candidate < vertex_count && (used[candidate] || in_degree[candidate] != 0)) {
+            ++candidate;
+        }
+        if (candidate < vertex_count) {
+            next_try[depth] = candidate + 1;
+            used[candidate] = true;
+            for (size_t k = offsets[candidate]; k < offsets[candidate + 1]; ++k) {
+                --in_degree[neighbors[k]];
+            }
+            chosen[depth++] = candidate;
+            next_try[depth] = 0;
+        } else {
+            if (depth == 0) {
+                break;
+            }
+            release(chosen[--depth]);
+        }
+    }
+    
+    sort_count = sorts.getSize();
+    if (sort_count == 0) {
+        return nullptr;
+    }
+    T** result = new T*[sort_count];
+    for (size_t i = 0; i < sort_count; ++i) {
+        result[i] = sorts[i];
+    }
+    return result;
+}
+
+//==================== MINIMUM SPANNING TREE ====================
+
+template<typename T>
+double Graph<T>::minimumSpanningTreePrim(Edge**& mst_edges, size_t& edge_count) {
+    // The caller owns the mst_edges array but not the edges in it: they point
+    // into this graph's edge lists and dangle after the next edge or vertex change
+    if (is_directed) {
+        throw std::logic_error("Minimum spanning tree needs an undirected graph");
+    }
+    mst_edges = vertex_count > 1 ? new Edge*[vertex_count - 1] : nullptr;
+    double total = primMSTHelper(mst_edges, edge_count);
+    if (edge_count == 0) {
+        delete[] mst_edges;
+        mst_edges = nullptr;
+    }
+    return total;
+}
+
+template<typename T>
+double Graph<T>::minimumSpanningTreeKruskal(Edge**& mst_edges, size_t& edge_count) {
+    // Same ownership as minimumSpanningTreePrim: delete[] the array, never the edges
+    if (is_directed) {
+        throw std::logic_error("Minimum spanning tree needs an undirected graph");
+    }
+    mst_edges = vertex_count > 1 ? new Edge*[vertex_count - 1] : nullptr;
+    double total = kruskalMSTHelper(mst_edges, edge_count);
+    if (edge_count == 0) {
+        delete[] mst_edges;
+        mst_edges = nullptr;
+    }
+    return total;
+}
+
+//==================== SPECIAL PROPERTIES ====================
+
+template<typename T>
+bool Graph<T>::isBipartite() {
+    DynamicArray<size_t> sides(vertex_count, 0);
+    return twoColorHelper(sides.getData());
+}
+
+template<typename T>
+T** Graph<T>::getBipartitePartitions(size_t*& partition_sizes) {
+    DynamicArray<size_t> sides(vertex_count, 0);
+    if (!twoColorHelper(sides.getData())) {
+        partition_sizes = nullptr;
+        return nullptr;
+    }
+    return groupComponents(sides.getData(), 2, partition_sizes);
+}
+
+template<typename T>
+bool Graph<T>::isPlanar() {
+    // Each undirected edge once, without self-loops or parallel edges
+    DynamicArray<size_t> offsets;
+    DynamicArray<size_t> neighbors;
+    indexAdjacency(offsets, neighbors, true);
+    DynamicArray<size_t> edges;
+    DynamicArray<size_t> last_seen(vertex_count, NO_INDEX);
+    for (size_t u = 0; u < vertex_count; ++u) {
+        for (size_t k = offsets[u]; k < offsets[u + 1]; ++k) {
+            size_t v = neighbors[k];
+            if (u < v && last_seen[v] != u) {
+                last_seen[v] = u;
+                edges.push_back(u);
+                edges.push_back(v);
+            }
+        }
+    }
+    size_t m = edges.getSize() / 2;
+    if (vertex_count < 5 || m < 9) {
+        return true;
+    }
+    if (m > 3 * vertex_count - 6) {
+        return false;
+    }
+    
+    // A graph is planar iff its biconnected blocks are; they come out of
+    // Tarjan's algorithm as runs of the edge stack
+    DynamicArray<size_t> adjacency_offsets(vertex_count + 1, 0);
+    DynamicArray<size_t> adjacent(2 * m, 0);
+    DynamicArray<size_t> incident(2 * m, 0);
+    for (size_t e = 0; e < m; ++e) {
+        ++adjacency_offsets[edges[2 * e] + 1];
+        ++adjacency_offsets[edges[2 * e + 1] + 1];
+    }
+    for (size_t v = 0; v < vertex_count; ++v) {
+        adjacency_offsets[v + 1] += adjacency_offsets[v];
+    }
+    DynamicArray<size_t> cursor(adjacency_offsets);
+    for (size_t e = 0; e < m; ++e) {
+        size_t a = edges[2 * e];
+        size_t b = edges[2 * e + 1];
+        adjacent[cursor[a]] = b;
+        incident[cursor[a]++] = e;
+        adjacent[cursor[b]] = a;
+        incident[cursor[b]++] = e;
+    }
+    
+    DynamicArray<size_t> order(vertex_count, NO_INDEX);
+    DynamicArray<size_t> low(vertex_count, 0);
+    DynamicArray<size_t> parent_edge(vertex_count, NO_INDEX);
+    DynamicArray<size_t> local(vertex_count, NO_INDEX);
+    DynamicArray<size_t> edge_stack;
+    DynamicArray<size_t> block_vertices;
+    DynamicArray<size_t> block_edges;
+    DynamicArray<std::pair<size_t, size_t>> calls;
+    size_t counter = 0;
+    for (size_t root = 0; root < vertex_count; ++root) {
+        if (order[root] != NO_INDEX) {
+            continue;
+        }
+        order[root] = low[root] = counter++;
+        calls.push_back(std::make_pair(root, adjacency_offsets[root]));
+        while (!calls.empty()) {
+            size_t vertex = calls.back().first;
+            size_t position = calls.back().second;
+            if (position < adjacency_offsets[vertex + 1]) {
+                calls.back().second = position + 1;
+                size_t next = adjacent[position];
+                size_t edge = incident[position];
+                if (edge == parent_edge[vertex]) {
+                    continue;
+                }
+                if (order[next] == NO_INDEX) {
+                    edge_stack.push_back(edge);
+                    parent_edge[next] = edge;
+                    order[next] = low[next] = counter++;
+                    calls.push_back(std::make_pair(next, adjacency_offsets[next]));
+                } else if (order[next] < order[vertex]) {
+                    edge_stack.push_back(edge);
+                    low[vertex] = std::min(low[vertex], order[next]);
+                }
+                continue;
+            }
+            
+            calls.pop_back();
+            if (calls.empty()) {
+                continue;
+            }
+            size_t parent = calls.back().first;
+            low[parent] = std::min(low[parent], low[vertex]);
+            if (low[vertex] < order[parent]) {
+                continue;
+            }
+            
+            // parent separates the block below it; renumber the block's vertices from 0
+            block_vertices.clear();
+            block_edges.clear();
+            size_t edge;
+            do {
+                edge = edge_stack.back();
+                edge_stack.pop_back();
+                for (size_t end = 0; end < 2; ++end) {
+                    size_t v = edges[2 * edge + end];
+                    if (local[v] == NO_INDEX) {
+                        local[v] = block_vertices.getSize();
+                        block_vertices.push_back(v);
+                    }
+                    block_edges.push_back(local[v]);
+                }
+            } while (edge != parent_edge[vertex]);
+            for (size_t k = 0; k < block_vertices.getSize(); ++k) {
+                local[block_vertices[k]] = NO_INDEX;
+            }
+            
+            size_t block_n = block_vertices.getSize();
+            size_t block_m = block_edges.getSize() / 2;
+            if (block_n >= 5 && block_m >= 9 && (block_m > 3 * block_n - 6 || !isPlanarBlock(block_n, block_edges))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template<typename T>
+int Graph<T>::chromaticNumber() {
+    if (vertex_count == 0) {
+        return 0;
+    }
+    DynamicArray<size_t> offsets;
+    DynamicArray<size_t> neighbors;
+    indexAdjacency(offsets, neighbors, true);
+    for (size_t v = 0; v < vertex_count; ++v) {
+        for (size_t k = offsets[v]; k < offsets[v + 1]; ++k) {
+            if (neighbors[k] == v) {
+                return -1;
+            }
+        }
+    }
+    if (neighbors.empty()) {
+        return 1;
+    }
+    
+    // Highest degree first keeps the search tree small
+    DynamicArray<size_t> order(vertex_count, 0);
+    for (size_t v = 0; v < vertex_count; ++v) {
+        order[v] = v;
+    }
+    std::stable_sort(order.getData(), order.getData() + vertex_count, [&](size_t a, size_t b) {
+        return offsets[a + 1] - offsets[a] > offsets[b + 1] - offsets[b];
+    });
+    int colors = 2;
+    while (!colorableHelper(offsets, neighbors, order.getData(), colors)) {
+        ++colors;
+    }
+    return colors;
+}
+
+template<typename T>
+T* Graph<T>::graphColoring(int*& colors) {
+    colors = nullptr;
+    if (vertex_count == 0) {
+        return nullptr;
+    }
+    DynamicArray<size_t> offsets;
+    DynamicArray<size_t> neighbors;
+    indexAdjacency(offsets, neighbors, true);
+    DynamicArray<size_t> order(vertex_count, 0);
+    for (size_t v = 0; v < vertex_count; ++v) {
+        order[v] = v;
+    }
+    std::stable_sort(order.getData(), order.getData() + vertex_count, [&](size_t a, size_t b) {
+        return offsets[a + 1] - offsets[a] > offsets[b + 1] - offsets[b];
+    });
     
-    // Iterator functions
-    VertexIterator begin();
-    VertexIterator end();
-    const VertexIterator begin() const;
-    const VertexIterator end() const;
-    EdgeIterator edgeBegin();
-    EdgeIterator edgeEnd();
-    const EdgeIterator edgeBegin() const;
-    const EdgeIterator edgeEnd() const;
-};
+    // Welsh-Powell: smallest color no colored neighbor has; taken[c] == v marks c as used around v
+    colors = new int[vertex_count];
+    std::fill(colors, colors + vertex_count, -1);
+    DynamicArray<size_t> taken(vertex_count + 1, NO_INDEX);
+    for (size_t i = 0; i < vertex_count; ++i) {
+        size_t vertex = order[i];
+        for (size_t k = offsets[vertex]; k < offsets[vertex + 1]; ++k) {
+            size_t next = neighbors[k];
+            if (next != vertex && colors[next] >= 0) {
+                taken[colors[next]] = vertex;
+            }
+        }
+        int color = 0;
+        while (taken[color] == vertex) {
+            ++color;
+        }
+        colors[vertex] = color;
+    }
+    return getVertices();
+}
+
+//==================== VERTEX ITERATOR IMPLEMENTATION ====================
+
+template<typename T>
+Graph<T>::VertexIterator::VertexIterator() : vertices(nullptr), vertex_count(0), current_index(0) {}
+
+template<typename T>
+Graph<T>::VertexIterator::VertexIterator(Vertex* v, size_t count, size_t index) : vertices(v), vertex_count(count), current_index(index) {}
+
+template<typename T>
+Graph<T>::VertexIterator::VertexIterator(const VertexIterator& other)
+    : vertices(other.vertices), vertex_count(other.vertex_count), current_index(other.current_index) {}
+
+template<typename T>
+typename Graph<T>::VertexIterator& Graph<T>::VertexIterator::operator=(const VertexIterator& other) {
+    vertices = other.vertices;
+    vertex_count = other.vertex_count;
+    current_index = other.current_index;
+    return *this;
+}
+
+template<typename T>
+T& Graph<T>::VertexIterator::operator*() {
+    if (current_index >= vertex_count) {
+        throw std::out_of_range("Iterator out of range");
+    }
+    return vertices[current_index].data;
+}
+
+template<typename T>
+const T& Graph<T>::VertexIterator::operator*() const {
+    if (current_index >= vertex_count) {
+        throw std::out_of_range("Iterator out of range");
+    }
+    return vertices[current_index].data;
+}
+
+template<typename T>
+T* Graph<T>::VertexIterator::operator->() {
+    return &(**this);
+}
+
+template<typename T>
+const T* Graph<T>::VertexIterator::operator->() const {
+    return &(**this);
+}
+
+template<typename T>
+typename Graph<T>::VertexIterator& Graph<T>::VertexIterator::operator++() {
+    ++current_index;
+    return *this;
+}
+
+template<typename T>
+typename Graph<T>::VertexIterator Graph<T>::VertexIterator::operator++(int) {
+    VertexIterator temp(*this);
+    ++current_index;
+    return temp;
+}
+
+template<typename T>
+bool Graph<T>::VertexIterator::operator==(const VertexIterator& other) const {
+    return vertices == other.vertices && current_index == other.current_index;
+}
+
+template<typename T>
+bool Graph<T>::VertexIterator::operator!=(const VertexIterator& other) const {
+    return !(*this == other);
+}
+
+//==================== EDGE ITERATOR IMPLEMENTATION ====================
+
+template<typename T>
+void Graph<T>::EdgeIterator::findNextEdge() {
+    while (!current_edge && current_vertex < vertex_count) {
+        current_edge = vertices[current_vertex].edge_list;
+        if (!current_edge) {
+            ++current_vertex;
+        }
+    }
+}
+
+template<typename T>
+Graph<T>::EdgeIterator::EdgeIterator() : vertices(nullptr), vertex_count(0), current_vertex(0), current_edge(nullptr) {}
+
+template<typename T>
+Graph<T>::EdgeIterator::EdgeIterator(Vertex* v, size_t count, size_t vertex_idx, Edge* edge)
+    : vertices(v), vertex_count(count), current_vertex(vertex_idx), current_edge(edge) {
+    findNextEdge();
+}
+
+template<typename T>
+Graph<T>::EdgeIterator::EdgeIterator(const EdgeIterator& other)
+    : vertices(other.vertices), vertex_count(other.vertex_count), current_vertex(other.current_vertex), current_edge(other.current_edge) {}
+
+template<typename T>
+typename Graph<T>::EdgeIterator& Graph<T>::EdgeIterator::operator=(const EdgeIterator& other) {
+    vertices = other.vertices;
+    vertex_count = other.vertex_count;
+    current_vertex = other.current_vertex;
+    current_edge = other.current_edge;
+    return *this;
+}
+
+template<typename T>
+typename Graph<T>::Edge& Graph<T>::EdgeIterator::operator*() {
+    if (!current_edge) {
+        throw std::out_of_range("Iterator out of range");
+    }
+    return *current_edge;
+}
+
+template<typename T>
+const typename Graph<T>::Edge& Graph<T>::EdgeIterator::operator*() const {
+    if (!current_edge) {
+        throw std::out_of_range("Iterator out of range");
+    }
+    return *current_edge;
+}
+
+template<typename T>
+typename Graph<T>::Edge* Graph<T>::EdgeIterator::operator->() {
+    return &(**this);
+}
+
+template<typename T>
+const typename Graph<T>::Edge* Graph<T>::EdgeIterator::operator->() const {
+    return &(**this);
+}
+
+template<typename T>
+typename Graph<T>::EdgeIterator& Graph<T>::EdgeIterator::operator++() {
+    if (current_edge) {
+        current_edge = current_edge->next;
+        if (!current_edge) {
+            ++current_vertex;
+            findNextEdge();
+        }
+    }
+    return *this;
+}
+
+template<typename T>
+typename Graph<T>::EdgeIterator Graph<T>::EdgeIterator::operator++(int) {
+    EdgeIterator temp(*this);
+    ++(*this);
+    return temp;
+}
+
+template<typename T>
+bool Graph<T>::EdgeIterator::operator==(const EdgeIterator& other) const {
+    return current_edge == other.current_edge && (current_edge || current_vertex == other.current_vertex);
+}
+
+template<typename T>
+bool Graph<T>::EdgeIterator::operator!=(const EdgeIterator& other) const {
+    return !(*this == other);
+}
+
+//==================== ITERATOR FUNCTIONS ====================
+
+template<typename T>
+typename Graph<T>::VertexIterator Graph<T>::begin() {
+    return VertexIterator(vertices, vertex_count, 0);
+}
+
+template<typename T>
+typename Graph<T>::VertexIterator Graph<T>::end() {
+    return VertexIterator(vertices, vertex_count, vertex_count);
+}
+
+template<typename T>
+const typename Graph<T>::VertexIterator Graph<T>::begin() const {
+    return VertexIterator(vertices, vertex_count, 0);
+}
+
+template<typename T>
+const typename Graph<T>::VertexIterator Graph<T>::end() const {
+    return VertexIterator(vertices, vertex_count, vertex_count);
+}
+
+template<typename T>
+typename Graph<T>::EdgeIterator Graph<T>::edgeBegin() {
+    return EdgeIterator(vertices, vertex_count, 0, nullptr);
+}
+
+template<typename T>
+typename Graph<T>::EdgeIterator Graph<T>::edgeEnd() {
+    return EdgeIterator(vertices, vertex_count, vertex_count, nullptr);
+}
+
+template<typename T>
+const typename Graph<T>::EdgeIterator Graph<T>::edgeBegin() const {
+    return EdgeIterator(vertices, vertex_count, 0, nullptr);
+}
+
+template<typename T>
+const typename Graph<T>::EdgeIterator Graph<T>::edgeEnd() const {
+    return EdgeIterator(vertices, vertex_count, vertex_count, nullptr);
+}
 
 #endif
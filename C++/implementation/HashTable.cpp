@@ -1,131 +1,1656 @@
-//==================== HASH TABLE ====================
-#ifndef HASH_TABLE_H
-#define HASH_TABLE_H
-
-template<typename Key, typename Value>
-class HashTable {
-private:
-    struct KeyValuePair {
-        Key key;
-        Value value;
-        bool is_deleted;
-        bool is_occupied;
+//==================== HASH TABLE IMPLEMENTATION ====================
+#ifndef HASH_TABLE_CPP
+#define HASH_TABLE_CPP
+
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+#include <string_view>
+#include "../header/HashTable.h"
+
+#ifdef HASH_TABLE_USE_SSE2
+#include <emmintrin.h>
+#include <xmmintrin.h>
+#endif
+
+#ifdef HASH_TABLE_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//==================== SIZING POLICIES ====================
+
+inline size_t PrimeSizing::roundCapacity(size_t n) {
+    return nextPrime(n);
+}
+
+inline size_t PrimeSizing::reduce(size_t value, size_t bucket_count) {
+    return value % bucket_count;
+}
+
+inline size_t PrimeSizing::nextPrime(size_t n) {
+    if (n <= 2) {
+        return 2;
+    }
+    if (n % 2 == 0) {
+        ++n;
+    }
+    while (!isPrime(n)) {
+        n += 2;
+    }
+    return n;
+}
+
+inline bool PrimeSizing::isPrime(size_t n) {
+    if (n < 2) return false;
+    if (n < 4) return true;
+    if (n % 2 == 0 || n % 3 == 0) return false;
+    for (size_t i = 5; i * i <= n; i += 6) {
+        if (n % i == 0 || n % (i + 2) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline size_t PowerOfTwoSizing::roundCapacity(size_t n) {
+    size_t capacity = 1;
+    while (capacity < n) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+inline size_t PowerOfTwoSizing::reduce(size_t value, size_t bucket_count) {
+    return value & (bucket_count - 1);
+}
+
+inline size_t TransparentStringHash::operator()(std::string_view value) const {
+    return std::hash<std::string_view>{}(value);
+}
+
+//==================== KEY VALUE PAIR CONSTRUCTORS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair::KeyValuePair() : key(), value() {}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair::KeyValuePair(const Key& k, const Value& v) : key(k), value(v) {}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair::KeyValuePair(Key&& k, Value&& v)
+    : key(std::move(k)), value(std::move(v)) {}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair::KeyValuePair(const KeyValuePair& other)
+    : key(other.key), value(other.value) {}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair::KeyValuePair(KeyValuePair&& other) noexcept
+    : key(std::move(other.key)), value(std::move(other.value)) {}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair& HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair::operator=(const KeyValuePair& other) {
+    if (this != &other) {
+        key = other.key;
+        value = other.value;
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair& HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair::operator=(KeyValuePair&& other) noexcept {
+    if (this != &other) {
+        key = std::move(other.key);
+        value = std::move(other.value);
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair::~KeyValuePair() {}
+
+//==================== HASH FUNCTIONS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::hash(const K& key) const {
+    // Murmur3 finalizer: std::hash is often the identity, and a power-of-two
+    // mask only looks at the low bits
+    uint64_t h = static_cast<uint64_t>(Hash{}(key));
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return static_cast<size_t>(h);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::hash(const Key& key, size_t table_size) const {
+    return Sizing::reduce(hash(key), table_size);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::doubleHash(size_t hash_value, size_t attempt) const {
+    // The step must be coprime with the bucket count: any odd step for a power
+    // of two, anything in [1, bucket_count - 1] for a prime
+    uint64_t h = static_cast<uint64_t>(hash_value) * 0x9E3779B97F4A7C15ULL;
+    size_t step;
+    if (Sizing::power_of_two) {
+        step = static_cast<size_t>(h >> 32) | 1;
+    } else {
+        step = bucket_count > 1 ? 1 + static_cast<size_t>(h >> 32) % (bucket_count - 1) : 1;
+    }
+    return attempt * step;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+uint8_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::fragment(size_t hash_value) const {
+    // Top 7 bits of the mixed hash, independent of the low bits used for the slot
+    return static_cast<uint8_t>(hash_value >> (sizeof(size_t) * 8 - 7));
+}
+
+//==================== PROBING FUNCTIONS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::linearProbe(size_t hash_value, size_t attempt) const {
+    return Sizing::reduce(hash_value + attempt, bucket_count);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::quadraticProbe(size_t hash_value, size_t attempt) const {
+    // Triangular offsets visit every slot of a power-of-two table
+    size_t offset = Sizing::power_of_two ? attempt * (attempt + 1) / 2 : attempt * attempt;
+    return Sizing::reduce(hash_value + offset, bucket_count);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::doubleHashProbe(size_t home, size_t attempt, size_t hash_value) const {
+    return Sizing::reduce(home + doubleHash(hash_value, attempt), bucket_count);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::probe(size_t home, size_t attempt, size_t hash_value) const {
+    switch (probing_mode) {
+        case ProbingMode::Quadratic:
+            return quadraticProbe(home, attempt);
+        case ProbingMode::DoubleHash:
+            return doubleHashProbe(home, attempt, hash_value);
+        default:
+            return linearProbe(home, attempt);
+    }
+}
+
+//==================== CONTROL BYTE HELPERS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+uint32_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::matchGroup(const uint8_t* group, uint8_t value) {
+#ifdef HASH_TABLE_USE_SSE2
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    __m128i match = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(value)));
+    return static_cast<uint32_t>(_mm_movemask_epi8(match));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < GROUP_WIDTH; ++i) {
+        if (group[i] == value) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+uint32_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::matchEmptyOrDeleted(const uint8_t* group) {
+#ifdef HASH_TABLE_USE_SSE2
+    // Empty and deleted are the only states with the high bit set
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    return static_cast<uint32_t>(_mm_movemask_epi8(bytes));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < GROUP_WIDTH; ++i) {
+        if (group[i] & 0x80) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::lowestBit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_ctz(mask));
+#else
+    size_t index = 0;
+    while (!(mask & 1u)) {
+        mask >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::prefetch(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#elif defined(HASH_TABLE_USE_SSE2)
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+    (void)address;
+#endif
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool HashTable<Key, Value, Sizing, Hash, KeyEqual>::isFull(size_t index) const {
+    return (control[index] & 0x80) == 0;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::setControl(size_t index, uint8_t value) {
+    control[index] = value;
+    // Keep the mirrored tail in sync so group loads never need to wrap
+    for (size_t mirror = index + bucket_count; mirror < bucket_count + GROUP_WIDTH - 1; mirror += bucket_count) {
+        control[mirror] = value;
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::wrapIndex(size_t index) const {
+    return index < bucket_count ? index : Sizing::reduce(index, bucket_count);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::nextGroup(size_t position) const {
+    position += GROUP_WIDTH;
+    while (position >= bucket_count) {
+        position -= bucket_count;
+    }
+    return position;
+}
+
+//==================== PRIVATE HELPER FUNCTIONS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::rehash() {
+    completeMigration();
+    
+    // Mostly tombstones: clean up at the same size, otherwise grow
+    size_t new_capacity = deleted_count > size ? bucket_count : Sizing::roundCapacity(bucket_count * 2);
+    if (migration_step > 0) {
+        beginMigration(new_capacity);
+    } else {
+        resize(new_capacity);
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::resize(size_t new_capacity) {
+    if (new_capacity < 1) {
+        new_capacity = 1;
+    }
+    
+    KeyValuePair* old_buckets = buckets;
+    uint8_t* old_control = control;
+    uint32_t* old_distances = distances;
+    size_t old_count = bucket_count;
+    
+    bucket_count = new_capacity;
+    initializeBuckets();
+    size = 0;
+    deleted_count = 0;
+    
+    for (size_t i = 0; i < old_count; ++i) {
+        if ((old_control[i] & 0x80) == 0) {
+            placeNew(std::move(old_buckets[i]));
+            old_buckets[i].~KeyValuePair();
+        }
+    }
+    
+    deallocateSlots(old_buckets, old_count);
+    delete[] old_control;
+    delete[] old_distances;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::findSlot(const K& key) const {
+    return findSlot(key, hash(key));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::findSlot(const K& key, size_t hash_value) const {
+    if (probing_mode == ProbingMode::Group) {
+        return findSlotGroup(key, hash_value);
+    }
+    if (probing_mode == ProbingMode::RobinHood) {
+        return findSlotRobinHood(key, hash_value);
+    }
+    if (probing_mode == ProbingMode::Cuckoo) {
+        return findSlotCuckoo(key, hash_value);
+    }
+    
+    uint8_t tag = fragment(hash_value);
+    size_t home = Sizing::reduce(hash_value, bucket_count);
+    for (size_t attempt = 0; attempt < bucket_count; ++attempt) {
+        size_t slot = probe(home, attempt, hash_value);
+        if (control[slot] == CONTROL_EMPTY) {
+            return bucket_count;
+        }
+        if (control[slot] == tag && KeyEqual{}(buckets[slot].key, key)) {
+            return slot;
+        }
+    }
+    return bucket_count;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::findInsertSlot(const Key& key) const {
+    size_t hash_value = hash(key);
+    if (probing_mode == ProbingMode::Group) {
+        return findInsertSlotGroup(hash_value);
+    }
+    
+    size_t home = Sizing::reduce(hash_value, bucket_count);
+    for (size_t attempt = 0; attempt < bucket_count; ++attempt) {
+        size_t slot = probe(home, attempt, hash_value);
+        if (!isFull(slot)) {
+            return slot;
+        }
+    }
+    return bucket_count;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::findSlotGroup(const K& key, size_t hash_value) const {
+    uint8_t tag = fragment(hash_value);
+    size_t position = Sizing::reduce(hash_value, bucket_count);
+    for (size_t probed = 0; probed < bucket_count; probed += GROUP_WIDTH) {
+        const uint8_t* group = control + position;
+        uint32_t candidates = matchGroup(group, tag);
+        while (candidates) {
+            size_t slot = wrapIndex(position + lowestBit(candidates));
+            if (KeyEqual{}(buckets[slot].key, key)) {
+                return slot;
+            }
+            candidates &= candidates - 1;
+        }
+        if (matchGroup(group, CONTROL_EMPTY)) {
+            return bucket_count;
+        }
+        position = nextGroup(position);
+    }
+    return bucket_count;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::findInsertSlotGroup(size_t hash_value) const {
+    size_t position = Sizing::reduce(hash_value, bucket_count);
+    for (size_t probed = 0; probed < bucket_count; probed += GROUP_WIDTH) {
+        uint32_t available = matchEmptyOrDeleted(control + position);
+        if (available) {
+            return wrapIndex(position + lowestBit(available));
+        }
+        position = nextGroup(position);
+    }
+    return bucket_count;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::findSlotRobinHood(const K& key, size_t hash_value) const {
+    uint8_t tag = fragment(hash_value);
+    size_t slot = Sizing::reduce(hash_value, bucket_count);
+    for (size_t distance = 0; distance < bucket_count; ++distance) {
+        // Entries are ordered by distance, so a richer resident means the key is absent
+        if (control[slot] == CONTROL_EMPTY || distances[slot] < distance) {
+            return bucket_count;
+        }
+        if (control[slot] == tag && KeyEqual{}(buckets[slot].key, key)) {
+            return slot;
+        }
+        slot = slot + 1 == bucket_count ? 0 : slot + 1;
+    }
+    return bucket_count;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::placeRobinHood(KeyValuePair&& pair) {
+    // Caller guarantees the key is absent and a free slot exists
+    size_t hash_value = hash(pair.key);
+    uint8_t tag = fragment(hash_value);
+    uint32_t distance = 0;
+    size_t slot = Sizing::reduce(hash_value, bucket_count);
+    size_t placed = bucket_count;
+    
+    while (true) {
+        if (control[slot] == CONTROL_EMPTY) {
+            setControl(slot, tag);
+            distances[slot] = distance;
+            new (&buckets[slot]) KeyValuePair(std::move(pair));
+            ++size;
+            return placed == bucket_count ? slot : placed;
+        }
+        if (distances[slot] < distance) {
+            // The resident is closer to home, so it gives up its slot and moves on
+            std::swap(buckets[slot], pair);
+            std::swap(distances[slot], distance);
+            uint8_t resident_tag = control[slot];
+            setControl(slot, tag);
+            tag = resident_tag;
+            if (placed == bucket_count) {
+                placed = slot;
+            }
+        }
+        slot = slot + 1 == bucket_count ? 0 : slot + 1;
+        ++distance;
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::eraseRobinHood(size_t slot) {
+    // Backward-shift deletion: pull displaced followers one step closer to home
+    buckets[slot].~KeyValuePair();
+    size_t next = slot + 1 == bucket_count ? 0 : slot + 1;
+    while (isFull(next) && distances[next] > 0) {
+        new (&buckets[slot]) KeyValuePair(std::move(buckets[next]));
+        buckets[next].~KeyValuePair();
+        setControl(slot, control[next]);
+        distances[slot] = distances[next] - 1;
+        slot = next;
+        next = next + 1 == bucket_count ? 0 : next + 1;
+    }
+    setControl(slot, CONTROL_EMPTY);
+    distances[slot] = 0;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::probeDistance(size_t slot) const {
+    if (probing_mode == ProbingMode::RobinHood) {
+        return distances[slot];
+    }
+    
+    size_t hash_value = hash(buckets[slot].key);
+    if (probing_mode == ProbingMode::Cuckoo) {
+        // 0 in the primary bucket, 1 in the alternate one
+        return slot / CUCKOO_WAYS == cuckooBucket(hash_value, 0) ? 0 : 1;
+    }
+    size_t home = Sizing::reduce(hash_value, bucket_count);
+    if (probing_mode == ProbingMode::Linear || probing_mode == ProbingMode::Group) {
+        return slot >= home ? slot - home : slot + bucket_count - home;
+    }
+    for (size_t attempt = 0; attempt < bucket_count; ++attempt) {
+        if (probe(home, attempt, hash_value) == slot) {
+            return attempt;
+        }
+    }
+    return bucket_count;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::cuckooBucket(size_t hash_value, size_t choice) const {
+    // Buckets are CUCKOO_WAYS adjacent slots; any slots past the last full
+    // bucket of a prime-sized table stay unused
+    size_t bucket_total = bucket_count / CUCKOO_WAYS;
+    size_t primary = Sizing::reduce(hash_value, bucket_total);
+    if (choice == 0) {
+        return primary;
+    }
+    size_t alternate = Sizing::reduce(primary + doubleHash(hash_value, 1), bucket_total);
+    if (alternate == primary) {
+        alternate = primary + 1 == bucket_total ? 0 : primary + 1;
+    }
+    return alternate;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::cuckooFreeSlot(size_t bucket) const {
+    for (size_t way = 0; way < CUCKOO_WAYS; ++way) {
+        if (!isFull(bucket * CUCKOO_WAYS + way)) {
+            return bucket * CUCKOO_WAYS + way;
+        }
+    }
+    return bucket_count;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::findSlotCuckoo(const K& key, size_t hash_value) const {
+    uint8_t tag = fragment(hash_value);
+    for (size_t choice = 0; choice < 2; ++choice) {
+        size_t first = cuckooBucket(hash_value, choice) * CUCKOO_WAYS;
+        for (size_t slot = first; slot < first + CUCKOO_WAYS; ++slot) {
+            if (control[slot] == tag && KeyEqual{}(buckets[slot].key, key)) {
+                return slot;
+            }
+        }
+    }
+    return bucket_count;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::placeCuckoo(KeyValuePair&& pair) {
+    // Caller guarantees the key is absent
+    size_t hash_value = hash(pair.key);
+    uint8_t tag = fragment(hash_value);
+    size_t bucket = cuckooBucket(hash_value, 0);
+    for (size_t choice = 0; choice < 2; ++choice) {
+        size_t slot = cuckooFreeSlot(cuckooBucket(hash_value, choice));
+        if (slot != bucket_count) {
+            if (control[slot] == CONTROL_DELETED) {
+                --deleted_count;
+            }
+            setControl(slot, tag);
+            new (&buckets[slot]) KeyValuePair(std::move(pair));
+            ++size;
+            return slot;
+        }
+    }
+    
+    // Both buckets are full: evict residents along a bounded random walk,
+    // tracking where the new entry sits in case the walk displaces it again
+    size_t path[CUCKOO_MAX_KICKS];
+    size_t placed = bucket_count;
+    uint32_t state = static_cast<uint32_t>(hash_value) | 1;
+    for (size_t kick = 0; kick < CUCKOO_MAX_KICKS; ++kick) {
+        state = state * 1103515245u + 12345u;
+        size_t victim = bucket * CUCKOO_WAYS + (state >> 30) % CUCKOO_WAYS;
+        path[kick] = victim;
+        placed = placed == bucket_count ? victim : (placed == victim ? bucket_count : placed);
+        std::swap(buckets[victim], pair);
+        uint8_t victim_tag = control[victim];
+        setControl(victim, tag);
+        tag = victim_tag;
         
-        // KeyValuePair constructors to implement
-        KeyValuePair();
-        KeyValuePair(const Key& k, const Value& v);
-        KeyValuePair(Key&& k, Value&& v);
-        KeyValuePair(const KeyValuePair& other);
-        KeyValuePair(KeyValuePair&& other) noexcept;
-        KeyValuePair& operator=(const KeyValuePair& other);
-        KeyValuePair& operator=(KeyValuePair&& other) noexcept;
-        ~KeyValuePair();
+        size_t evicted_hash = hash(pair.key);
+        size_t primary = cuckooBucket(evicted_hash, 0);
+        bucket = primary == victim / CUCKOO_WAYS ? cuckooBucket(evicted_hash, 1) : primary;
+        size_t slot = cuckooFreeSlot(bucket);
+        if (slot != bucket_count) {
+            if (control[slot] == CONTROL_DELETED) {
+                --deleted_count;
+            }
+            setControl(slot, tag);
+            new (&buckets[slot]) KeyValuePair(std::move(pair));
+            ++size;
+            return placed == bucket_count ? slot : placed;
+        }
+    }
+    
+    // Unwind the walk so the new entry is the one left over, then grow
+    for (size_t kick = CUCKOO_MAX_KICKS; kick-- > 0;) {
+        std::swap(buckets[path[kick]], pair);
+        uint8_t victim_tag = control[path[kick]];
+        setControl(path[kick], tag);
+        tag = victim_tag;
+    }
+    if (size * 8 < bucket_count) {
+        // Failing this sparse means many keys share both buckets outright,
+        // which growing the table would not fix
+        throw std::runtime_error("Cuckoo insertion failed, too many keys share the same hash");
+    }
+    resize(Sizing::roundCapacity(bucket_count * 2));
+    return placeCuckoo(std::move(pair));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::placeNew(KeyValuePair&& pair) {
+    // Caller guarantees the key is absent
+    if (probing_mode == ProbingMode::RobinHood) {
+        return placeRobinHood(std::move(pair));
+    }
+    if (probing_mode == ProbingMode::Cuckoo) {
+        return placeCuckoo(std::move(pair));
+    }
+    
+    size_t slot = findInsertSlot(pair.key);
+    while (slot == bucket_count) {
+        resize(Sizing::roundCapacity(bucket_count * 2));
+        slot = findInsertSlot(pair.key);
+    }
+    
+    if (control[slot] == CONTROL_DELETED) {
+        --deleted_count;
+    }
+    setControl(slot, fragment(hash(pair.key)));
+    new (&buckets[slot]) KeyValuePair(std::move(pair));
+    ++size;
+    return slot;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool HashTable<Key, Value, Sizing, Hash, KeyEqual>::needsResize() const {
+    return static_cast<double>(size + deleted_count + 1) > bucket_count * MAX_LOAD_FACTOR;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool HashTable<Key, Value, Sizing, Hash, KeyEqual>::insertMayResize(const Key& key) const {
+    // Conservative: false only when inserting key cannot replace the arrays
+    if (draining || needsResize()) {
+        return true;
+    }
+    if (probing_mode == ProbingMode::RobinHood) {
+        return false;
+    }
+    if (probing_mode == ProbingMode::Cuckoo) {
+        // A full pair of buckets starts a kick walk, which may end in a resize
+        size_t hash_value = hash(key);
+        return cuckooFreeSlot(cuckooBucket(hash_value, 0)) == bucket_count &&
+               cuckooFreeSlot(cuckooBucket(hash_value, 1)) == bucket_count;
+    }
+    return findInsertSlot(key) == bucket_count;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+double HashTable<Key, Value, Sizing, Hash, KeyEqual>::loadFactor() const {
+    return bucket_count ? static_cast<double>(getSize()) / bucket_count : 0.0;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::copyFrom(const HashTable& other) {
+    draining = other.draining ? new HashTable(*other.draining) : nullptr;
+    migrate_index = other.migrate_index;
+    migration_step = other.migration_step;
+    bucket_count = other.bucket_count;
+    size = other.size;
+    deleted_count = other.deleted_count;
+    probing_mode = other.probing_mode;
+    buckets = allocateSlots(bucket_count);
+    control = new uint8_t[bucket_count + GROUP_WIDTH - 1];
+    std::copy(other.control, other.control + bucket_count + GROUP_WIDTH - 1, control);
+    distances = other.distances ? new uint32_t[bucket_count] : nullptr;
+    for (size_t i = 0; i < bucket_count; ++i) {
+        if (isFull(i)) {
+            new (&buckets[i]) KeyValuePair(other.buckets[i]);
+        }
+        // Lookups in a draining table still read the distances behind its tombstones
+        if (distances && control[i] != CONTROL_EMPTY) {
+            distances[i] = other.distances[i];
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::moveFrom(HashTable&& other) {
+    buckets = other.buckets;
+    control = other.control;
+    distances = other.distances;
+    bucket_count = other.bucket_count;
+    size = other.size;
+    deleted_count = other.deleted_count;
+    probing_mode = other.probing_mode;
+    draining = other.draining;
+    migrate_index = other.migrate_index;
+    migration_step = other.migration_step;
+    next_control = other.next_control;
+    next_count = other.next_count;
+    next_filled = other.next_filled;
+    mapped_region = other.mapped_region;
+    mapped_length = other.mapped_length;
+    
+    other.buckets = nullptr;
+    other.control = nullptr;
+    other.distances = nullptr;
+    other.bucket_count = 0;
+    other.size = 0;
+    other.deleted_count = 0;
+    other.draining = nullptr;
+    other.migrate_index = 0;
+    other.next_control = nullptr;
+    other.mapped_region = nullptr;
+    other.mapped_length = 0;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::initializeBuckets() {
+    if (probing_mode == ProbingMode::Cuckoo && bucket_count < 2 * CUCKOO_WAYS) {
+        bucket_count = Sizing::roundCapacity(2 * CUCKOO_WAYS);
+    }
+    // Slots stay raw storage until an entry is placed, and distances are only
+    // read for full slots, so neither array is touched here
+    buckets = allocateSlots(bucket_count);
+    size_t control_bytes = bucket_count + GROUP_WIDTH - 1;
+    if (next_control && next_count == bucket_count) {
+        control = next_control;
+        std::fill(control + next_filled, control + control_bytes, CONTROL_EMPTY);
+    } else {
+        delete[] next_control;
+        control = new uint8_t[control_bytes];
+        std::fill(control, control + control_bytes, CONTROL_EMPTY);
+    }
+    next_control = nullptr;
+    distances = nullptr;
+    if (probing_mode == ProbingMode::RobinHood) {
+        distances = new uint32_t[bucket_count];
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::destroyBuckets() {
+    if (mapped_region) {
+#ifdef HASH_TABLE_USE_MMAP
+        munmap(mapped_region, mapped_length);
+#endif
+        mapped_region = nullptr;
+        mapped_length = 0;
+    } else {
+        // A fully drained table has no live entries left to visit
+        if (size > 0) {
+            for (size_t i = 0; i < bucket_count; ++i) {
+                if (isFull(i)) {
+                    buckets[i].~KeyValuePair();
+                }
+            }
+        }
+        deallocateSlots(buckets, bucket_count);
+        delete[] control;
+        delete[] distances;
+    }
+    buckets = nullptr;
+    control = nullptr;
+    distances = nullptr;
+    delete[] next_control;
+    next_control = nullptr;
+    delete draining;
+    draining = nullptr;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair* HashTable<Key, Value, Sizing, Hash, KeyEqual>::allocateSlots(size_t count) {
+    return std::allocator<KeyValuePair>().allocate(count);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::deallocateSlots(KeyValuePair* slots, size_t count) {
+    if (slots) {
+        std::allocator<KeyValuePair>().deallocate(slots, count);
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::ensureWritable() const {
+    if (mapped_region) {
+        throw std::runtime_error("HashTable is mapped read-only");
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::MappedHeader HashTable<Key, Value, Sizing, Hash, KeyEqual>::mappedLayout(size_t bucket_count, ProbingMode mode) {
+    auto align = [](uint64_t offset) {
+        return (offset + MAPPED_ALIGNMENT - 1) / MAPPED_ALIGNMENT * MAPPED_ALIGNMENT;
     };
+    MappedHeader header = {};
+    header.magic = MAPPED_MAGIC;
+    header.version = MAPPED_VERSION;
+    header.probing_mode = static_cast<uint32_t>(mode);
+    header.bucket_count = bucket_count;
+    header.pair_size = sizeof(KeyValuePair);
+    header.key_size = sizeof(Key);
+    header.value_size = sizeof(Value);
+    header.power_of_two = Sizing::power_of_two ? 1 : 0;
+    header.buckets_offset = align(sizeof(MappedHeader));
+    header.control_offset = align(header.buckets_offset + bucket_count * sizeof(KeyValuePair));
+    header.file_size = header.control_offset + bucket_count + GROUP_WIDTH - 1;
+    if (mode == ProbingMode::RobinHood) {
+        header.distances_offset = align(header.file_size);
+        header.file_size = header.distances_offset + bucket_count * sizeof(uint32_t);
+    }
+    return header;
+}
+
+//==================== LOOKUP HELPERS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+const Value* HashTable<Key, Value, Sizing, Hash, KeyEqual>::findValue(const K& key) const {
+    // Lookups never migrate, so returned pointers survive other lookups
+    size_t slot = findSlot(key);
+    if (slot != bucket_count) {
+        return &buckets[slot].value;
+    }
+    return draining ? static_cast<const HashTable*>(draining)->findValue(key) : nullptr;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+Value& HashTable<Key, Value, Sizing, Hash, KeyEqual>::findOrInsert(const K& key) {
+    ensureWritable();
+    migrateStep();
+    Value* existing = const_cast<Value*>(findValue(key));
+    if (existing) {
+        return *existing;
+    }
+    if (needsResize()) {
+        rehash();
+    }
+    // placeNew may grow the table, so index buckets only after it returns
+    size_t slot = placeNew(KeyValuePair(Key(key), Value()));
+    return buckets[slot].value;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+bool HashTable<Key, Value, Sizing, Hash, KeyEqual>::removeKey(const K& key) {
+    ensureWritable();
+    migrateStep();
+    size_t slot = findSlot(key);
+    if (slot == bucket_count) {
+        if (draining) {
+            size_t old_slot = draining->findSlot(key);
+            if (old_slot != draining->bucket_count) {
+                draining->retireSlot(old_slot);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    if (probing_mode == ProbingMode::RobinHood) {
+        eraseRobinHood(slot);
+        --size;
+        return true;
+    }
+    if (probing_mode == ProbingMode::Cuckoo) {
+        // Lookups never walk past a slot, so it can simply be emptied
+        buckets[slot].~KeyValuePair();
+        setControl(slot, CONTROL_EMPTY);
+        --size;
+        return true;
+    }
     
-    KeyValuePair* buckets;
-    size_t bucket_count;
-    size_t size;
-    size_t deleted_count;
-    
-    // Hash functions to implement
-    size_t hash(const Key& key) const;
-    size_t hash(const Key& key, size_t table_size) const;
-    size_t doubleHash(const Key& key, size_t attempt) const;
-    
-    // Probing functions to implement
-    size_t linearProbe(size_t hash_value, size_t attempt) const;
-    size_t quadraticProbe(size_t hash_value, size_t attempt) const;
-    size_t doubleHashProbe(size_t hash_value, size_t attempt, const Key& key) const;
-    
-    // Private helper functions to implement
-    void rehash();
-    void resize(size_t new_capacity);
-    size_t findSlot(const Key& key) const;
-    size_t findInsertSlot(const Key& key) const;
-    bool needsResize() const;
-    double loadFactor() const;
-    size_t nextPrime(size_t n) const;
-    bool isPrime(size_t n) const;
-    void copyFrom(const HashTable& other);
-    void moveFrom(HashTable&& other);
-    void initializeBuckets();
-    void destroyBuckets();
-    
-public:
-    // Constructors and Destructor
-    HashTable(size_t initial_capacity = 17);
-    HashTable(const HashTable& other);
-    HashTable(HashTable&& other) noexcept;
-    ~HashTable();
-    
-    // Assignment operators
-    HashTable& operator=(const HashTable& other);
-    HashTable& operator=(HashTable&& other) noexcept;
-    
-    // Element access
-    Value& operator[](const Key& key);
-    Value& operator[](Key&& key);
-    Value& at(const Key& key);
-    const Value& at(const Key& key) const;
-    
-    // Modifiers
-    void insert(const Key& key, const Value& value);
-    void insert(Key&& key, Value&& value);
-    void insert(const KeyValuePair& pair);
-    void insert(KeyValuePair&& pair);
-    template<typename... Args>
-    void emplace(const Key& key, Args&&... args);
-    template<typename... Args>
-    void emplace(Key&& key, Args&&... args);
-    bool remove(const Key& key);
-    void clear();
-    void swap(HashTable& other);
-    
-    // Lookup operations
-    bool contains(const Key& key) const;
-    Value* find(const Key& key);
-    const Value* find(const Key& key) const;
-    
-    // Capacity
-    size_t getSize() const;
-    bool empty() const;
-    size_t getBucketCount() const;
-    double getLoadFactor() const;
-    size_t getCollisionCount() const;
-    
-    // Hash table operations
-    void rehashToSize(size_t new_size);
-    void reserve(size_t min_capacity);
-    
-    // Iterator class
-    class Iterator {
-    private:
-        KeyValuePair* buckets;
-        size_t bucket_count;
-        size_t current_index;
+    buckets[slot].~KeyValuePair();
+    setControl(slot, CONTROL_DELETED);
+    --size;
+    ++deleted_count;
+    return true;
+}
+
+//==================== INCREMENTAL RESIZE ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::beginMigration(size_t new_capacity) {
+    // The current arrays become the draining table; new entries go to fresh arrays.
+    // Control bytes prepared ahead of time stay with the new arrays.
+    draining = new HashTable(std::move(*this));
+    std::swap(next_control, draining->next_control);
+    next_count = draining->next_count;
+    next_filled = draining->next_filled;
+    bucket_count = new_capacity;
+    initializeBuckets();
+    size = 0;
+    deleted_count = 0;
+    migrate_index = 0;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::migrateStep() {
+    if (!draining) {
+        prepareControl();
+        return;
+    }
+    
+    // Never slower than the drain can afford: every call adds at most one entry, and
+    // the new table must not reach its load limit before the old one is empty, or
+    // the next insert would fall back to a stop-the-world completeMigration
+    size_t remaining = draining->bucket_count - migrate_index;
+    size_t filled = size + deleted_count + draining->size;
+    size_t capacity_limit = static_cast<size_t>(bucket_count * MAX_LOAD_FACTOR);
+    size_t headroom = capacity_limit > filled + 1 ? capacity_limit - filled - 1 : 0;
+    size_t step = headroom ? std::max(migration_step, (remaining + headroom - 1) / headroom) : remaining;
+    
+    size_t first = migrate_index;
+    size_t limit = std::min(draining->bucket_count, migrate_index + step);
+    for (; migrate_index < limit; ++migrate_index) {
+        if (draining->isFull(migrate_index)) {
+            placeNew(std::move(draining->buckets[migrate_index]));
+            draining->retireSlot(migrate_index);
+        }
+    }
+    draining->releaseDrained(first, migrate_index);
+    
+    if (migrate_index >= draining->bucket_count || draining->size == 0) {
+        delete draining;
+        draining = nullptr;
+        migrate_index = 0;
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::completeMigration() {
+    if (!draining) {
+        return;
+    }
+    size_t step = migration_step;
+    migration_step = draining->bucket_count;
+    migrateStep();
+    migration_step = step;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::retireSlot(size_t slot) {
+    // A tombstone keeps later entries reachable in every probing mode,
+    // and unlike backward shifting it never moves entries behind the migration cursor
+    buckets[slot].~KeyValuePair();
+    setControl(slot, CONTROL_DELETED);
+    --size;
+    ++deleted_count;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::prepareControl() {
+    // Past half the load limit, fill the control bytes of the doubled table a few
+    // groups per call, so beginMigration does not write them all at once
+    if (migration_step == 0 || static_cast<double>(size + deleted_count) * 2 < bucket_count * MAX_LOAD_FACTOR) {
+        return;
+    }
+    if (!next_control) {
+        next_count = Sizing::roundCapacity(bucket_count * 2);
+        next_control = new uint8_t[next_count + GROUP_WIDTH - 1];
+        next_filled = 0;
+    }
+    size_t end = std::min(next_count + GROUP_WIDTH - 1, next_filled + migration_step * GROUP_WIDTH);
+    std::fill(next_control + next_filled, next_control + end, CONTROL_EMPTY);
+    next_filled = end;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::releaseDrained(size_t from, size_t to) {
+#ifdef HASH_TABLE_USE_MMAP
+    // Slots in [0, to) are all tombstones, so the whole pages among them go back to
+    // the system as the cursor passes, and the final free has little left to unmap.
+    // Pages partly before the array or past the cursor are left alone.
+    static const uintptr_t page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t base = reinterpret_cast<uintptr_t>(buckets);
+    uintptr_t start = std::max((base + page - 1) & ~(page - 1), (base + from * sizeof(KeyValuePair)) & ~(page - 1));
+    uintptr_t end = (base + to * sizeof(KeyValuePair)) & ~(page - 1);
+    if (end > start) {
+        madvise(reinterpret_cast<void*>(start), end - start, MADV_DONTNEED);
+    }
+#else
+    (void)from;
+    (void)to;
+#endif
+}
+
+//==================== CONSTRUCTORS AND DESTRUCTOR ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::HashTable(size_t initial_capacity, ProbingMode mode)
+    : buckets(nullptr), control(nullptr), distances(nullptr), bucket_count(0), size(0), deleted_count(0), probing_mode(mode),
+      draining(nullptr), migrate_index(0), migration_step(0), next_control(nullptr), next_count(0), next_filled(0),
+      mapped_region(nullptr), mapped_length(0) {
+    bucket_count = Sizing::roundCapacity(initial_capacity);
+    initializeBuckets();
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::HashTable(const HashTable& other)
+    : buckets(nullptr), control(nullptr), distances(nullptr), bucket_count(0), size(0), deleted_count(0), probing_mode(other.probing_mode),
+      draining(nullptr), migrate_index(0), migration_step(0), next_control(nullptr), next_count(0), next_filled(0),
+      mapped_region(nullptr), mapped_length(0) {
+    copyFrom(other);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::HashTable(HashTable&& other) noexcept
+    : buckets(nullptr), control(nullptr), distances(nullptr), bucket_count(0), size(0), deleted_count(0), probing_mode(other.probing_mode),
+      draining(nullptr), migrate_index(0), migration_step(0), next_control(nullptr), next_count(0), next_filled(0),
+      mapped_region(nullptr), mapped_length(0) {
+    moveFrom(std::move(other));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::~HashTable() {
+    destroyBuckets();
+}
+
+//==================== ASSIGNMENT OPERATORS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>& HashTable<Key, Value, Sizing, Hash, KeyEqual>::operator=(const HashTable& other) {
+    if (this != &other) {
+        destroyBuckets();
+        copyFrom(other);
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>& HashTable<Key, Value, Sizing, Hash, KeyEqual>::operator=(HashTable&& other) noexcept {
+    if (this != &other) {
+        destroyBuckets();
+        moveFrom(std::move(other));
+    }
+    return *this;
+}
+
+//==================== ELEMENT ACCESS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+Value& HashTable<Key, Value, Sizing, Hash, KeyEqual>::operator[](const Key& key) {
+    return findOrInsert(key);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+Value& HashTable<Key, Value, Sizing, Hash, KeyEqual>::operator[](Key&& key) {
+    ensureWritable();
+    migrateStep();
+    Value* existing = find(key);
+    if (existing) {
+        return *existing;
+    }
+    if (needsResize()) {
+        rehash();
+    }
+    size_t slot = placeNew(KeyValuePair(std::move(key), Value()));
+    return buckets[slot].value;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+Value& HashTable<Key, Value, Sizing, Hash, KeyEqual>::at(const Key& key) {
+    Value* existing = find(key);
+    if (!existing) {
+        throw std::out_of_range("Key not found");
+    }
+    return *existing;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+const Value& HashTable<Key, Value, Sizing, Hash, KeyEqual>::at(const Key& key) const {
+    const Value* existing = find(key);
+    if (!existing) {
+        throw std::out_of_range("Key not found");
+    }
+    return *existing;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::template IfTransparent<K, Value&>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::operator[](const K& key) {
+    return findOrInsert(key);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::template IfTransparent<K, Value&>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::at(const K& key) {
+    Value* existing = find(key);
+    if (!existing) {
+        throw std::out_of_range("Key not found");
+    }
+    return *existing;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::template IfTransparent<K, const Value&>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::at(const K& key) const {
+    const Value* existing = find(key);
+    if (!existing) {
+        throw std::out_of_range("Key not found");
+    }
+    return *existing;
+}
+
+//==================== MODIFIERS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::insert(const Key& key, const Value& value) {
+    insert(KeyValuePair(key, value));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::insert(Key&& key, Value&& value) {
+    insert(KeyValuePair(std::move(key), std::move(value)));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::insert(const KeyValuePair& pair) {
+    insert(KeyValuePair(pair));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::insert(KeyValuePair&& pair) {
+    ensureWritable();
+    migrateStep();
+    Value* existing = find(pair.key);
+    if (existing) {
+        *existing = std::move(pair.value);
+        return;
+    }
+    if (needsResize()) {
+        rehash();
+    }
+    placeNew(std::move(pair));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename... Args>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::emplace(const Key& key, Args&&... args) {
+    insert(KeyValuePair(key, Value(std::forward<Args>(args)...)));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename... Args>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::emplace(Key&& key, Args&&... args) {
+    insert(KeyValuePair(std::move(key), Value(std::forward<Args>(args)...)));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool HashTable<Key, Value, Sizing, Hash, KeyEqual>::remove(const Key& key) {
+    return removeKey(key);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::template IfTransparent<K, bool>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::remove(const K& key) {
+    return removeKey(key);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::clear() {
+    ensureWritable();
+    delete draining;
+    draining = nullptr;
+    migrate_index = 0;
+    for (size_t i = 0; i < bucket_count; ++i) {
+        if (isFull(i)) {
+            buckets[i].~KeyValuePair();
+        }
+    }
+    std::fill(control, control + bucket_count + GROUP_WIDTH - 1, CONTROL_EMPTY);
+    if (distances) {
+        std::fill(distances, distances + bucket_count, 0);
+    }
+    size = 0;
+    deleted_count = 0;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::swap(HashTable& other) {
+    std::swap(buckets, other.buckets);
+    std::swap(control, other.control);
+    std::swap(distances, other.distances);
+    std::swap(bucket_count, other.bucket_count);
+    std::swap(size, other.size);
+    std::swap(deleted_count, other.deleted_count);
+    std::swap(probing_mode, other.probing_mode);
+    std::swap(draining, other.draining);
+    std::swap(migrate_index, other.migrate_index);
+    std::swap(migration_step, other.migration_step);
+    std::swap(next_control, other.next_control);
+    std::swap(next_count, other.next_count);
+    std::swap(next_filled, other.next_filled);
+    std::swap(mapped_region, other.mapped_region);
+    std::swap(mapped_length, other.mapped_length);
+}
+
+//==================== LOOKUP OPERATIONS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool HashTable<Key, Value, Sizing, Hash, KeyEqual>::contains(const Key& key) const {
+    return findValue(key) != nullptr;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+Value* HashTable<Key, Value, Sizing, Hash, KeyEqual>::find(const Key& key) {
+    return const_cast<Value*>(findValue(key));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+const Value* HashTable<Key, Value, Sizing, Hash, KeyEqual>::find(const Key& key) const {
+    return findValue(key);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::template IfTransparent<K, bool>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::contains(const K& key) const {
+    return findValue(key) != nullptr;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::template IfTransparent<K, Value*>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::find(const K& key) {
+    return const_cast<Value*>(findValue(key));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::template IfTransparent<K, const Value*>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::find(const K& key) const {
+    return findValue(key);
+}
+
+//==================== BULK OPERATIONS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename InputIterator>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::insertBulk(InputIterator first, InputIterator last) {
+    using Category = typename std::iterator_traits<InputIterator>::iterator_category;
+    if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value) {
+        // One resize up front instead of a rehash every time the load factor trips
+        reserve(getSize() + static_cast<size_t>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) {
+        insert(first->first, first->second);
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::findBatch(const Key* keys, size_t count, Value** results) {
+    static_cast<const HashTable*>(this)->findBatch(keys, count, const_cast<const Value**>(results));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::findBatch(const Key* keys, size_t count, const Value** results) const {
+    size_t hashes[BATCH_SIZE];
+    for (size_t base = 0; base < count; base += BATCH_SIZE) {
+        size_t batch = std::min(BATCH_SIZE, count - base);
         
-        void findNextValid();
+        // Issue every home-slot load of the batch before waiting on any of them
+        for (size_t i = 0; i < batch; ++i) {
+            hashes[i] = hash(keys[base + i]);
+            if (probing_mode == ProbingMode::Cuckoo) {
+                size_t alternate = cuckooBucket(hashes[i], 1) * CUCKOO_WAYS;
+                prefetch(control + alternate);
+                prefetch(buckets + alternate);
+            }
+            size_t home = probing_mode == ProbingMode::Cuckoo ? cuckooBucket(hashes[i], 0) * CUCKOO_WAYS
+                                                              : Sizing::reduce(hashes[i], bucket_count);
+            prefetch(control + home);
+            prefetch(buckets + home);
+            if (distances) {
+                prefetch(distances + home);
+            }
+        }
         
-    public:
-        Iterator();
-        Iterator(KeyValuePair* buckets, size_t bucket_count, size_t start_index);
-        Iterator(const Iterator& other);
-        Iterator& operator=(const Iterator& other);
-        KeyValuePair& operator*();
-        const KeyValuePair& operator*() const;
-        KeyValuePair* operator->();
-        const KeyValuePair* operator->() const;
-        Iterator& operator++();
-        Iterator operator++(int);
-        bool operator==(const Iterator& other) const;
-        bool operator!=(const Iterator& other) const;
+        for (size_t i = 0; i < batch; ++i) {
+            const Key& key = keys[base + i];
+            size_t slot = findSlot(key, hashes[i]);
+            if (slot != bucket_count) {
+                results[base + i] = &buckets[slot].value;
+            } else {
+                results[base + i] = draining ? static_cast<const HashTable*>(draining)->findValue(key) : nullptr;
+            }
+        }
+    }
+}
+
+//==================== PERSISTENCE ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::saveToFile(const std::string& path) const {
+    static_assert(std::is_trivially_copyable<Key>::value && std::is_trivially_copyable<Value>::value,
+                  "Only trivially copyable keys and values can be saved");
+    if (draining) {
+        // The format holds a single table, finish the resize on a copy
+        HashTable settled(*this);
+        settled.completeMigration();
+        settled.saveToFile(path);
+        return;
+    }
+    
+    MappedHeader header = mappedLayout(bucket_count, probing_mode);
+    header.size = size;
+    header.deleted_count = deleted_count;
+    
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot open " + path + " for writing");
+    }
+    auto writeAt = [&out](uint64_t offset, const void* data, size_t length) {
+        static const char padding[MAPPED_ALIGNMENT] = {};
+        std::streamoff gap = static_cast<std::streamoff>(offset) - out.tellp();
+        out.write(padding, gap);
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(length));
     };
+    // Slots and distances that are not full are raw storage, written as zeros
+    static const char zeros[std::max(sizeof(KeyValuePair), sizeof(uint32_t))] = {};
+    writeAt(0, &header, sizeof(header));
+    writeAt(header.buckets_offset, nullptr, 0);
+    for (size_t i = 0; i < bucket_count; ++i) {
+        out.write(isFull(i) ? reinterpret_cast<const char*>(buckets + i) : zeros, sizeof(KeyValuePair));
+    }
+    writeAt(header.control_offset, control, bucket_count + GROUP_WIDTH - 1);
+    if (distances) {
+        writeAt(header.distances_offset, nullptr, 0);
+        for (size_t i = 0; i < bucket_count; ++i) {
+            out.write(isFull(i) ? reinterpret_cast<const char*>(distances + i) : zeros, sizeof(uint32_t));
+        }
+    }
+    out.flush();
+    if (!out) {
+        throw std::runtime_error("Failed writing " + path);
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual> HashTable<Key, Value, Sizing, Hash, KeyEqual>::mapFile(const std::string& path) {
+    static_assert(std::is_trivially_copyable<Key>::value && std::is_trivially_copyable<Value>::value,
+                  "Only trivially copyable keys and values can be mapped");
+#ifdef HASH_TABLE_USE_MMAP
+    int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    struct stat info;
+    if (fstat(descriptor, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(MappedHeader)) {
+        close(descriptor);
+        throw std::runtime_error("Not a HashTable file: " + path);
+    }
+    size_t length = static_cast<size_t>(info.st_size);
+    void* region = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if (region == MAP_FAILED) {
+        throw std::runtime_error("Cannot map " + path);
+    }
+    
+    // Everything but the counters must match what this instantiation would write
+    MappedHeader header;
+    std::memcpy(&header, region, sizeof(header));
+    MappedHeader expected = mappedLayout(header.bucket_count, static_cast<ProbingMode>(header.probing_mode));
+    if (header.magic != MAPPED_MAGIC || header.version != MAPPED_VERSION ||
+        header.probing_mode > static_cast<uint32_t>(ProbingMode::Cuckoo) || header.bucket_count == 0 ||
+        header.pair_size != expected.pair_size || header.key_size != expected.key_size ||
+        header.value_size != expected.value_size || header.power_of_two != expected.power_of_two ||
+        header.buckets_offset != expected.buckets_offset || header.control_offset != expected.control_offset ||
+        header.distances_offset != expected.distances_offset || header.file_size != expected.file_size ||
+        header.file_size > length) {
+        munmap(region, length);
+        throw std::runtime_error("Incompatible HashTable file: " + path);
+    }
     
-    // Iterator functions
-    Iterator begin();
-    Iterator end();
-    const Iterator begin() const;
-    const Iterator end() const;
-};
+    HashTable table(1, static_cast<ProbingMode>(header.probing_mode));
+    table.destroyBuckets();
+    char* base = static_cast<char*>(region);
+    table.buckets = reinterpret_cast<KeyValuePair*>(base + header.buckets_offset);
+    table.control = reinterpret_cast<uint8_t*>(base + header.control_offset);
+    table.distances = header.distances_offset ? reinterpret_cast<uint32_t*>(base + header.distances_offset) : nullptr;
+    table.bucket_count = header.bucket_count;
+    table.size = header.size;
+    table.deleted_count = header.deleted_count;
+    table.mapped_region = region;
+    table.mapped_length = length;
+    return table;
+#else
+    (void)path;
+    throw std::runtime_error("Memory-mapped HashTable files are not supported on this platform");
+#endif
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool HashTable<Key, Value, Sizing, Hash, KeyEqual>::isMapped() const {
+    return mapped_region != nullptr;
+}
+
+//==================== CAPACITY ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::getSize() const {
+    return draining ? size + draining->size : size;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool HashTable<Key, Value, Sizing, Hash, KeyEqual>::empty() const {
+    return getSize() == 0;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::getBucketCount() const {
+    // While migrating this is the capacity being migrated into
+    return bucket_count;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+double HashTable<Key, Value, Sizing, Hash, KeyEqual>::getLoadFactor() const {
+    return loadFactor();
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::getCollisionCount() const {
+    // Entries that could not be stored in their home slot (home group in Group mode)
+    size_t collisions = 0;
+    for (size_t i = 0; i < bucket_count; ++i) {
+        if (!isFull(i)) {
+            continue;
+        }
+        size_t distance = probeDistance(i);
+        if (probing_mode == ProbingMode::Group ? distance >= GROUP_WIDTH : distance != 0) {
+            ++collisions;
+        }
+    }
+    return draining ? collisions + draining->getCollisionCount() : collisions;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Sizing, Hash, KeyEqual>::getMaxProbeDistance() const {
+    size_t longest = 0;
+    for (size_t i = 0; i < bucket_count; ++i) {
+        if (isFull(i)) {
+            longest = std::max(longest, probeDistance(i));
+        }
+    }
+    return draining ? std::max(longest, draining->getMaxProbeDistance()) : longest;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+double HashTable<Key, Value, Sizing, Hash, KeyEqual>::getMeanProbeDistance() const {
+    if (getSize() == 0) {
+        return 0.0;
+    }
+    double total = 0.0;
+    for (size_t i = 0; i < bucket_count; ++i) {
+        if (isFull(i)) {
+            total += static_cast<double>(probeDistance(i));
+        }
+    }
+    if (draining) {
+        total += draining->getMeanProbeDistance() * draining->size;
+    }
+    return total / getSize();
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+ProbingMode HashTable<Key, Value, Sizing, Hash, KeyEqual>::getProbingMode() const {
+    return probing_mode;
+}
+
+//==================== HASH TABLE OPERATIONS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::rehashToSize(size_t new_size) {
+    ensureWritable();
+    completeMigration();
+    size_t minimum = static_cast<size_t>(size / MAX_LOAD_FACTOR) + 1;
+    resize(Sizing::roundCapacity(std::max(new_size, minimum)));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::reserve(size_t min_capacity) {
+    ensureWritable();
+    size_t required = static_cast<size_t>(min_capacity / MAX_LOAD_FACTOR) + 1;
+    if (required > bucket_count) {
+        completeMigration();
+        resize(Sizing::roundCapacity(required));
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::setIncrementalResize(size_t buckets_per_step) {
+    migration_step = buckets_per_step;
+    if (migration_step == 0) {
+        completeMigration();
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool HashTable<Key, Value, Sizing, Hash, KeyEqual>::isResizing() const {
+    return draining != nullptr;
+}
+
+//==================== ITERATOR IMPLEMENTATION ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::isValid() const {
+    if (current_index < old_bucket_count) {
+        return (old_control[current_index] & 0x80) == 0;
+    }
+    return (control[current_index - old_bucket_count] & 0x80) == 0;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair* HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::current() const {
+    if (current_index >= old_bucket_count + bucket_count) {
+        throw std::out_of_range("Iterator out of range");
+    }
+    if (current_index < old_bucket_count) {
+        return &old_buckets[current_index];
+    }
+    return &buckets[current_index - old_bucket_count];
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::findNextValid() {
+    while (current_index < old_bucket_count + bucket_count && !isValid()) {
+        ++current_index;
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::Iterator()
+    : old_buckets(nullptr), old_control(nullptr), old_bucket_count(0),
+      buckets(nullptr), control(nullptr), bucket_count(0), current_index(0) {}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::Iterator(KeyValuePair* buckets, const uint8_t* control, size_t bucket_count, size_t start_index)
+    : old_buckets(nullptr), old_control(nullptr), old_bucket_count(0),
+      buckets(buckets), control(control), bucket_count(bucket_count), current_index(start_index) {
+    findNextValid();
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::Iterator(KeyValuePair* old_buckets, const uint8_t* old_control, size_t old_bucket_count,
+                                          KeyValuePair* buckets, const uint8_t* control, size_t bucket_count, size_t start_index)
+    : old_buckets(old_buckets), old_control(old_control), old_bucket_count(old_bucket_count),
+      buckets(buckets), control(control), bucket_count(bucket_count), current_index(start_index) {
+    findNextValid();
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::Iterator(const Iterator& other)
+    : old_buckets(other.old_buckets), old_control(other.old_control), old_bucket_count(other.old_bucket_count),
+      buckets(other.buckets), control(other.control), bucket_count(other.bucket_count), current_index(other.current_index) {}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator& HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::operator=(const Iterator& other) {
+    if (this != &other) {
+        old_buckets = other.old_buckets;
+        old_control = other.old_control;
+        old_bucket_count = other.old_bucket_count;
+        buckets = other.buckets;
+        control = other.control;
+        bucket_count = other.bucket_count;
+        current_index = other.current_index;
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair& HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::operator*() {
+    return *current();
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+const typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair& HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::operator*() const {
+    return *current();
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair* HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::operator->() {
+    return current();
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+const typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::KeyValuePair* HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::operator->() const {
+    return current();
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator& HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::operator++() {
+    if (current_index < old_bucket_count + bucket_count) {
+        ++current_index;
+        findNextValid();
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::operator++(int) {
+    Iterator temp(*this);
+    ++(*this);
+    return temp;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::operator==(const Iterator& other) const {
+    return buckets == other.buckets && current_index == other.current_index;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::operator!=(const Iterator& other) const {
+    return !(*this == other);
+}
+
+//==================== ITERATOR FUNCTIONS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator HashTable<Key, Value, Sizing, Hash, KeyEqual>::begin() {
+    if (draining) {
+        return Iterator(draining->buckets, draining->control, draining->bucket_count, buckets, control, bucket_count, 0);
+    }
+    return Iterator(buckets, control, bucket_count, 0);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator HashTable<Key, Value, Sizing, Hash, KeyEqual>::end() {
+    if (draining) {
+        return Iterator(draining->buckets, draining->control, draining->bucket_count,
+                        buckets, control, bucket_count, draining->bucket_count + bucket_count);
+    }
+    return Iterator(buckets, control, bucket_count, bucket_count);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+const typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator HashTable<Key, Value, Sizing, Hash, KeyEqual>::begin() const {
+    if (draining) {
+        return Iterator(draining->buckets, draining->control, draining->bucket_count, buckets, control, bucket_count, 0);
+    }
+    return Iterator(buckets, control, bucket_count, 0);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+const typename HashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator HashTable<Key, Value, Sizing, Hash, KeyEqual>::end() const {
+    if (draining) {
+        return Iterator(draining->buckets, draining->control, draining->bucket_count,
+                        buckets, control, bucket_count, draining->bucket_count + bucket_count);
+    }
+    return Iterator(buckets, control, bucket_count, bucket_count);
+}
 
 #endif
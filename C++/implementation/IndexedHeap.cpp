@@ -0,0 +1,288 @@
+//==================== INDEXED HEAP IMPLEMENTATION ====================
+#ifndef INDEXED_HEAP_CPP
+#define INDEXED_HEAP_CPP
+
+#include <utility>
+#include "../header/IndexedHeap.h"
+#include "vectors.cpp"
+
+//==================== BINARY HEAP ====================
+
+inline BinaryHeap::BinaryHeap() : generation(1) {}
+
+inline void BinaryHeap::place(size_t slot, uint32_t vertex, double key) {
+    heap[slot] = vertex;
+    keys[slot] = key;
+    positions[vertex] = static_cast<uint32_t>(slot);
+}
+
+inline void BinaryHeap::siftUp(size_t slot) {
+    uint32_t vertex = heap[slot];
+    double key = keys[slot];
+    while (slot > 0) {
+        size_t parent = (slot - 1) / 2;
+        if (keys[parent] <= key) {
+            break;
+        }
+        place(slot, heap[parent], keys[parent]);
+        slot = parent;
+    }
+    place(slot, vertex, key);
+}
+
+inline void BinaryHeap::siftDown(size_t slot) {
+    uint32_t vertex = heap[slot];
+    double key = keys[slot];
+    size_t size = heap.getSize();
+    for (;;) {
+        size_t child = 2 * slot + 1;
+        if (child >= size) {
+            break;
+        }
+        if (child + 1 < size && keys[child + 1] < keys[child]) {
+            ++child;
+        }
+        if (keys[child] >= key) {
+            break;
+        }
+        place(slot, heap[child], keys[child]);
+        slot = child;
+    }
+    place(slot, vertex, key);
+}
+
+inline void BinaryHeap::reset(size_t vertex_count) {
+    if (stamps.getSize() < vertex_count) {
+        positions.resize(vertex_count, 0);
+        stamps.resize(vertex_count, 0);
+    }
+}
+
+inline void BinaryHeap::clear() {
+    heap.clear();
+    keys.clear();
+    if (++generation == 0) {
+        stamps.assign(stamps.getSize(), 0);
+        generation = 1;
+    }
+}
+
+inline bool BinaryHeap::empty() const {
+    return heap.empty();
+}
+
+inline size_t BinaryHeap::getSize() const {
+    return heap.getSize();
+}
+
+inline void BinaryHeap::push(uint32_t vertex, double key) {
+    if (stamps[vertex] == generation) {
+        size_t slot = positions[vertex];
+        if (key < keys[slot]) {
+            keys[slot] = key;
+            siftUp(slot);
+        }
+        return;
+    }
+    stamps[vertex] = generation;
+    heap.push_back(vertex);
+    keys.push_back(key);
+    siftUp(heap.getSize() - 1);
+}
+
+inline uint32_t BinaryHeap::pop() {
+    uint32_t top = heap[0];
+    stamps[top] = generation - 1;
+    uint32_t moved = heap.back();
+    double moved_key = keys.back();
+    heap.pop_back();
+    keys.pop_back();
+    if (!heap.empty()) {
+        place(0, moved, moved_key);
+        siftDown(0);
+    }
+    return top;
+}
+
+//==================== PAIRING HEAP ====================
+
+inline PairingHeap::PairingHeap() : root(NONE), size(0), generation(1) {}
+
+inline uint32_t PairingHeap::meld(uint32_t first, uint32_t second) {
+    // Both are roots; the larger key becomes the leftmost child of the smaller
+    if (nodes[second].key < nodes[first].key) {
+        std::swap(first, second);
+    }
+    nodes[second].sibling = nodes[first].child;
+    if (nodes[first].child != NONE) {
+        nodes[nodes[first].child].previous = second;
+    }
+    nodes[second].previous = first;
+    nodes[first].child = second;
+    return first;
+}
+
+inline void PairingHeap::cut(uint32_t vertex) {
+    uint32_t before = nodes[vertex].previous;
+    if (nodes[before].child == vertex) {
+        nodes[before].child = nodes[vertex].sibling;
+    } else {
+        nodes[before].sibling = nodes[vertex].sibling;
+    }
+    if (nodes[vertex].sibling != NONE) {
+        nodes[nodes[vertex].sibling].previous = before;
+    }
+    nodes[vertex].sibling = NONE;
+    nodes[vertex].previous = NONE;
+}
+
+inline void PairingHeap::reset(size_t vertex_count) {
+    if (nodes.getSize() < vertex_count) {
+        nodes.resize(vertex_count, Node{0.0, NONE, NONE, NONE, 0});
+    }
+}
+
+inline void PairingHeap::clear() {
+    root = NONE;
+    size = 0;
+    if (++generation == 0) {
+        for (size_t v = 0; v < nodes.getSize(); ++v) {
+            nodes[v].stamp = 0;
+        }
+        generation = 1;
+    }
+}
+
+inline bool PairingHeap::empty() const {
+    return size == 0;
+}
+
+inline size_t PairingHeap::getSize() const {
+    return size;
+}
+
+inline void PairingHeap::push(uint32_t vertex, double key) {
+    if (nodes[vertex].stamp == generation) {
+        if (key < nodes[vertex].key) {
+            nodes[vertex].key = key;
+            if (vertex != root) {
+                cut(vertex);
+                root = meld(root, vertex);
+            }
+        }
+        return;
+    }
+    nodes[vertex].stamp = generation;
+    nodes[vertex].key = key;
+    nodes[vertex].child = NONE;
+    nodes[vertex].sibling = NONE;
+    nodes[vertex].previous = NONE;
+    root = root == NONE ? vertex : meld(root, vertex);
+    ++size;
+}
+
+inline uint32_t PairingHeap::pop() {
+    uint32_t top = root;
+    nodes[top].stamp = generation - 1;
+    --size;
+    
+    // Two-pass merge: meld the children in pairs left to right, then fold the
+    // pairs into one tree right to left
+    pairs.clear();
+    uint32_t next = nodes[top].child;
+    while (next != NONE) {
+        uint32_t first = next;
+        uint32_t second = nodes[first].sibling;
+        next = second == NONE ? NONE : nodes[second].sibling;
+        nodes[first].sibling = NONE;
+        nodes[first].previous = NONE;
+        if (second != NONE) {
+            nodes[second].sibling = NONE;
+            nodes[second].previous = NONE;
+            first = meld(first, second);
+        }
+        pairs.push_back(first);
+    }
+    root = NONE;
+    for (size_t k = pairs.getSize(); k > 0; --k) {
+        root = root == NONE ? pairs[k - 1] : meld(pairs[k - 1], root);
+    }
+    return top;
+}
+
+//==================== RADIX HEAP ====================
+
+inline RadixHeap::RadixHeap() : last(0), size(0) {}
+
+inline size_t RadixHeap::bucketOf(uint64_t key) const {
+    // 0 for keys equal to last, otherwise one more than the highest differing bit
+    uint64_t difference = key ^ last;
+    if (difference == 0) {
+        return 0;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(64 - __builtin_clzll(difference));
+#else
+    size_t bucket = 0;
+    while (difference) {
+        difference >>= 1;
+        ++bucket;
+    }
+    return bucket;
+#endif
+}
+
+inline void RadixHeap::reset(size_t) {
+    // Buckets are not indexed by vertex, so they only grow with use
+}
+
+inline void RadixHeap::clear() {
+    for (size_t b = 0; b < BUCKET_COUNT; ++b) {
+        buckets[b].clear();
+    }
+    last = 0;
+    size = 0;
+}
+
+inline bool RadixHeap::empty() const {
+    return size == 0;
+}
+
+inline size_t RadixHeap::getSize() const {
+    return size;
+}
+
+inline void RadixHeap::push(uint32_t vertex, double key) {
+    uint64_t whole = static_cast<uint64_t>(key);
+    buckets[bucketOf(whole)].push_back(Entry{whole, vertex});
+    ++size;
+}
+
+inline uint32_t RadixHeap::pop() {
+    if (buckets[0].empty()) {
+        // The smallest key of the first non-empty bucket becomes last; every
+        // entry of that bucket then lands in a lower one
+        size_t b = 1;
+        while (buckets[b].empty()) {
+            ++b;
+        }
+        DynamicArray<Entry>& source = buckets[b];
+        uint64_t smallest = source[0].key;
+        for (size_t k = 1; k < source.getSize(); ++k) {
+            if (source[k].key < smallest) {
+                smallest = source[k].key;
+            }
+        }
+        last = smallest;
+        for (size_t k = 0; k < source.getSize(); ++k) {
+            buckets[bucketOf(source[k].key)].push_back(source[k]);
+        }
+        source.clear();
+    }
+    uint32_t vertex = buckets[0].back().vertex;
+    buckets[0].pop_back();
+    --size;
+    return vertex;
+}
+
+#endif
@@ -0,0 +1,409 @@
+//==================== MAPPED DYNAMIC ARRAY IMPLEMENTATION ====================
+#ifndef MAPPED_DYNAMIC_ARRAY_CPP
+#define MAPPED_DYNAMIC_ARRAY_CPP
+
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include "../header/MappedDynamicArray.h"
+#include "vectors.cpp"
+
+#ifdef MAPPED_ARRAY_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//==================== PRIVATE HELPER FUNCTIONS ====================
+
+template<typename T>
+void MappedDynamicArray<T>::mapLength(size_t length) {
+#ifdef MAPPED_ARRAY_USE_MMAP
+    // The file must cover the mapping before it is touched: extend the file
+    // before growing the mapping, shrink the mapping before the file
+    if (length > region_length && ftruncate(descriptor, static_cast<off_t>(length)) != 0) {
+        throw std::runtime_error("Cannot grow " + path);
+    }
+    void* mapped;
+    if (!region) {
+        mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    } else {
+#ifdef __linux__
+        mapped = mremap(region, region_length, length, MREMAP_MAYMOVE);
+#else
+        // Map the new length beside the old one; both share the file's pages,
+        // and the old mapping stays in use if this one fails
+        mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+        if (mapped != MAP_FAILED) {
+            munmap(region, region_length);
+        }
+#endif
+    }
+    if (mapped == MAP_FAILED) {
+        throw std::runtime_error("Cannot map " + path);
+    }
+    
+    bool shrinking = length < region_length;
+    region = static_cast<char*>(mapped);
+    region_length = length;
+    header = reinterpret_cast<FileHeader*>(region);
+    data = reinterpret_cast<T*>(region + DATA_OFFSET);
+    capacity = (length - DATA_OFFSET) / sizeof(T);
+    if (shrinking && ftruncate(descriptor, static_cast<off_t>(length)) != 0) {
+        throw std::runtime_error("Cannot shrink " + path);
+    }
+#else
+    (void)length;
+#endif
+}
+
+template<typename T>
+void MappedDynamicArray<T>::remap(size_t new_capacity) {
+    mapLength(DATA_OFFSET + std::max<size_t>(new_capacity, header->size) * sizeof(T));
+}
+
+template<typename T>
+void MappedDynamicArray<T>::grow(size_t required) {
+    if (required > capacity) {
+        remap(DoublingGrowth::grow(capacity, required));
+    }
+}
+
+template<typename T>
+void MappedDynamicArray<T>::closeFile() {
+#ifdef MAPPED_ARRAY_USE_MMAP
+    if (region) {
+        munmap(region, region_length);
+    }
+    if (descriptor >= 0) {
+        close(descriptor);
+    }
+#endif
+    region = nullptr;
+    region_length = 0;
+    header = nullptr;
+    data = nullptr;
+    capacity = 0;
+    descriptor = -1;
+}
+
+template<typename T>
+void MappedDynamicArray<T>::moveFrom(MappedDynamicArray&& other) {
+    path = std::move(other.path);
+    descriptor = other.descriptor;
+    region = other.region;
+    region_length = other.region_length;
+    header = other.header;
+    data = other.data;
+    capacity = other.capacity;
+    
+    other.region = nullptr;
+    other.region_length = 0;
+    other.header = nullptr;
+    other.data = nullptr;
+    other.capacity = 0;
+    other.descriptor = -1;
+}
+
+//==================== CONSTRUCTORS AND DESTRUCTOR ====================
+
+template<typename T>
+MappedDynamicArray<T>::MappedDynamicArray(const std::string& path, size_t initial_capacity)
+    : path(path), descriptor(-1), region(nullptr), region_length(0), header(nullptr), data(nullptr), capacity(0) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable elements can be mapped");
+    static_assert(alignof(T) <= DATA_OFFSET, "Element alignment exceeds the data offset");
+#ifdef MAPPED_ARRAY_USE_MMAP
+    descriptor = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (descriptor < 0) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    try {
+        struct stat info;
+        if (fstat(descriptor, &info) != 0) {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        size_t length = static_cast<size_t>(info.st_size);
+        if (length == 0) {
+            mapLength(DATA_OFFSET + initial_capacity * sizeof(T));
+            header->magic = FILE_MAGIC;
+            header->version = FILE_VERSION;
+            header->element_size = sizeof(T);
+            header->size = 0;
+            return;
+        }
+        
+        if (length < DATA_OFFSET) {
+            throw std::runtime_error("Not a MappedDynamicArray file: " + path);
+        }
+        mapLength(length);
+        if (header->magic != FILE_MAGIC || header->version != FILE_VERSION || header->element_size != sizeof(T) ||
+            header->size > capacity) {
+            throw std::runtime_error("Incompatible MappedDynamicArray file: " + path);
+        }
+        reserve(initial_capacity);
+    } catch (...) {
+        closeFile();
+        throw;
+    }
+#else
+    (void)initial_capacity;
+    throw std::runtime_error("Memory-mapped arrays are not supported on this platform");
+#endif
+}
+
+template<typename T>
+MappedDynamicArray<T>::MappedDynamicArray(MappedDynamicArray&& other) noexcept
+    : descriptor(-1), region(nullptr), region_length(0), header(nullptr), data(nullptr), capacity(0) {
+    moveFrom(std::move(other));
+}
+
+template<typename T>
+MappedDynamicArray<T>::~MappedDynamicArray() {
+    closeFile();
+}
+
+//==================== ASSIGNMENT OPERATORS ====================
+
+template<typename T>
+MappedDynamicArray<T>& MappedDynamicArray<T>::operator=(MappedDynamicArray&& other) noexcept {
+    if (this != &other) {
+        closeFile();
+        moveFrom(std::move(other));
+    }
+    return *this;
+}
+
+//==================== ELEMENT ACCESS ====================
+
+template<typename T>
+T& MappedDynamicArray<T>::operator[](size_t index) {
+    return data[index];
+}
+
+template<typename T>
+const T& MappedDynamicArray<T>::operator[](size_t index) const {
+    return data[index];
+}
+
+template<typename T>
+T& MappedDynamicArray<T>::at(size_t index) {
+    if (index >= getSize()) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    return data[index];
+}
+
+template<typename T>
+const T& MappedDynamicArray<T>::at(size_t index) const {
+    if (index >= getSize()) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    return data[index];
+}
+
+template<typename T>
+T& MappedDynamicArray<T>::front() {
+    if (empty()) {
+        throw std::runtime_error("Array is empty");
+    }
+    return data[0];
+}
+
+template<typename T>
+const T& MappedDynamicArray<T>::front() const {
+    if (empty()) {
+        throw std::runtime_error("Array is empty");
+    }
+    return data[0];
+}
+
+template<typename T>
+T& MappedDynamicArray<T>::back() {
+    if (empty()) {
+        throw std::runtime_error("Array is empty");
+    }
+    return data[header->size - 1];
+}
+
+template<typename T>
+const T& MappedDynamicArray<T>::back() const {
+    if (empty()) {
+        throw std::runtime_error("Array is empty");
+    }
+    return data[header->size - 1];
+}
+
+template<typename T>
+T* MappedDynamicArray<T>::getData() {
+    return data;
+}
+
+template<typename T>
+const T* MappedDynamicArray<T>::getData() const {
+    return data;
+}
+
+//==================== CAPACITY FUNCTIONS ====================
+
+template<typename T>
+size_t MappedDynamicArray<T>::getSize() const {
+    return header ? static_cast<size_t>(header->size) : 0;
+}
+
+template<typename T>
+size_t MappedDynamicArray<T>::getCapacity() const {
+    return capacity;
+}
+
+template<typename T>
+bool MappedDynamicArray<T>::empty() const {
+    return getSize() == 0;
+}
+
+template<typename T>
+void MappedDynamicArray<T>::reserve(size_t new_capacity) {
+    if (new_capacity > capacity) {
+        remap(new_capacity);
+    }
+}
+
+template<typename T>
+void MappedDynamicArray<T>::shrinkToFit() {
+    if (header->size < capacity) {
+        remap(header->size);
+    }
+}
+
+//==================== MODIFIERS ====================
+
+template<typename T>
+void MappedDynamicArray<T>::push_back(const T& value) {
+    // value may live in the mapping, which can move when it grows
+    T copy(value);
+    grow(header->size + 1);
+    data[header->size] = copy;
+    ++header->size;
+}
+
+template<typename T>
+void MappedDynamicArray<T>::pop_back() {
+    if (empty()) {
+        throw std::runtime_error("Array is empty");
+    }
+    --header->size;
+}
+
+template<typename T>
+void MappedDynamicArray<T>::insert(size_t index, const T& value) {
+    size_t size = getSize();
+    if (index > size) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    T copy(value);
+    grow(size + 1);
+    std::memmove(static_cast<void*>(data + index + 1), static_cast<const void*>(data + index), (size - index) * sizeof(T));
+    data[index] = copy;
+    ++header->size;
+}
+
+template<typename T>
+void MappedDynamicArray<T>::erase(size_t index) {
+    erase(index, index + 1);
+}
+
+template<typename T>
+void MappedDynamicArray<T>::erase(size_t start_index, size_t end_index) {
+    // Removes [start_index, end_index)
+    size_t size = getSize();
+    if (start_index > end_index || end_index > size) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    std::memmove(static_cast<void*>(data + start_index), static_cast<const void*>(data + end_index),
+                 (size - end_index) * sizeof(T));
+    header->size = size - (end_index - start_index);
+}
+
+template<typename T>
+void MappedDynamicArray<T>::clear() {
+    header->size = 0;
+}
+
+template<typename T>
+void MappedDynamicArray<T>::resize(size_t new_size) {
+    resize(new_size, T());
+}
+
+template<typename T>
+void MappedDynamicArray<T>::resize(size_t new_size, const T& value) {
+    T copy(value);
+    reserve(new_size);
+    std::fill(data + std::min<size_t>(header->size, new_size), data + new_size, copy);
+    header->size = new_size;
+}
+
+//==================== FILE OPERATIONS ====================
+
+template<typename T>
+void MappedDynamicArray<T>::adviseAccess(AccessHint hint) {
+#ifdef MAPPED_ARRAY_USE_MMAP
+    int advice = MADV_NORMAL;
+    switch (hint) {
+        case AccessHint::Normal:
+            advice = MADV_NORMAL;
+            break;
+        case AccessHint::Sequential:
+            advice = MADV_SEQUENTIAL;
+            break;
+        case AccessHint::Random:
+            advice = MADV_RANDOM;
+            break;
+        case AccessHint::WillNeed:
+            advice = MADV_WILLNEED;
+            break;
+    }
+    // Only a hint, a kernel that refuses it changes nothing observable
+    madvise(region, region_length, advice);
+#else
+    (void)hint;
+#endif
+}
+
+template<typename T>
+void MappedDynamicArray<T>::flush() {
+#ifdef MAPPED_ARRAY_USE_MMAP
+    if (msync(region, region_length, MS_SYNC) != 0) {
+        throw std::runtime_error("Failed writing " + path);
+    }
+#endif
+}
+
+template<typename T>
+const std::string& MappedDynamicArray<T>::getPath() const {
+    return path;
+}
+
+//==================== ITERATOR FUNCTIONS ====================
+
+template<typename T>
+T* MappedDynamicArray<T>::begin() {
+    return data;
+}
+
+template<typename T>
+T* MappedDynamicArray<T>::end() {
+    return data + getSize();
+}
+
+template<typename T>
+const T* MappedDynamicArray<T>::begin() const {
+    return data;
+}
+
+template<typename T>
+const T* MappedDynamicArray<T>::end() const {
+    return data + getSize();
+}
+
+#endif
@@ -0,0 +1,694 @@
+//==================== NODE HASH TABLE IMPLEMENTATION ====================
+#ifndef NODE_HASH_TABLE_CPP
+#define NODE_HASH_TABLE_CPP
+
+#include <stdexcept>
+#include <algorithm>
+#include <iterator>
+#include <new>
+#include <utility>
+#include "../header/NodeHashTable.h"
+#include "HashTable.cpp"
+
+//==================== NODE AND CELL CONSTRUCTORS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Node::Node(const Key& k, const Value& v) : key(k), value(v) {}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Node::Node(Key&& k, Value&& v) : key(std::move(k)), value(std::move(v)) {}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Cell::Cell() : next_free(EMPTY_NODE) {}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Cell::~Cell() {}
+
+//==================== HASH AND PROBING FUNCTIONS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+uint32_t NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::hash(const K& key) const {
+    // Same finalizer as HashTable; the low 32 bits are kept in the slot so
+    // resizing never has to touch a key again
+    uint64_t h = static_cast<uint64_t>(Hash{}(key));
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return static_cast<uint32_t>(h);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::home(uint32_t hash_value) const {
+    return Sizing::reduce(hash_value, bucket_count);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::distance(size_t slot) const {
+    size_t origin = home(slots[slot].hash);
+    return slot >= origin ? slot - origin : slot + bucket_count - origin;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::nextSlot(size_t slot) const {
+    return slot + 1 == bucket_count ? 0 : slot + 1;
+}
+
+//==================== NODE ARENA ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Node& NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::node(uint32_t index) const {
+    return chunks[index >> CHUNK_SHIFT][index & (CHUNK_SIZE - 1)].node;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename... Args>
+uint32_t NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::allocateNode(Args&&... args) {
+    // Reuse a freed cell before extending the arena
+    bool recycled = free_head != EMPTY_NODE;
+    uint32_t index = free_head;
+    if (!recycled) {
+        if (node_count == EMPTY_NODE) {
+            throw std::runtime_error("NodeHashTable node index space exhausted");
+        }
+        index = node_count;
+        if ((index >> CHUNK_SHIFT) == chunk_count) {
+            if (chunk_count == chunk_capacity) {
+                size_t new_capacity = chunk_capacity ? chunk_capacity * 2 : 4;
+                Cell** grown = new Cell*[new_capacity];
+                std::copy(chunks, chunks + chunk_count, grown);
+                delete[] chunks;
+                chunks = grown;
+                chunk_capacity = new_capacity;
+            }
+            chunks[chunk_count] = new Cell[CHUNK_SIZE];
+            ++chunk_count;
+        }
+    }
+    
+    Cell& cell = chunks[index >> CHUNK_SHIFT][index & (CHUNK_SIZE - 1)];
+    uint32_t next_free = recycled ? cell.next_free : EMPTY_NODE;
+    new (&cell.node) Node(std::forward<Args>(args)...);
+    if (recycled) {
+        free_head = next_free;
+    } else {
+        ++node_count;
+    }
+    return index;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::freeNode(uint32_t index) {
+    Cell& cell = chunks[index >> CHUNK_SHIFT][index & (CHUNK_SIZE - 1)];
+    cell.node.~Node();
+    cell.next_free = free_head;
+    free_head = index;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::destroyNodes() {
+    for (size_t i = 0; i < bucket_count; ++i) {
+        if (slots[i].node != EMPTY_NODE) {
+            node(slots[i].node).~Node();
+        }
+    }
+    for (size_t i = 0; i < chunk_count; ++i) {
+        delete[] chunks[i];
+    }
+    delete[] chunks;
+    chunks = nullptr;
+    chunk_count = 0;
+    chunk_capacity = 0;
+    node_count = 0;
+    free_head = EMPTY_NODE;
+}
+
+//==================== PRIVATE HELPER FUNCTIONS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+size_t NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::findSlot(const K& key) const {
+    if (size == 0) {
+        return bucket_count;
+    }
+    
+    uint32_t hash_value = hash(key);
+    size_t slot = home(hash_value);
+    for (size_t probe = 0; probe < bucket_count; ++probe) {
+        // Robin Hood order: a resident closer to home than we are ends the search
+        if (slots[slot].node == EMPTY_NODE || distance(slot) < probe) {
+            return bucket_count;
+        }
+        if (slots[slot].hash == hash_value && KeyEqual{}(node(slots[slot].node).key, key)) {
+            return slot;
+        }
+        slot = nextSlot(slot);
+    }
+    return bucket_count;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::placeSlot(Slot entry) {
+    size_t slot = home(entry.hash);
+    size_t probe = 0;
+    while (slots[slot].node != EMPTY_NODE) {
+        size_t resident = distance(slot);
+        if (resident < probe) {
+            std::swap(entry, slots[slot]);
+            probe = resident;
+        }
+        slot = nextSlot(slot);
+        ++probe;
+    }
+    slots[slot] = entry;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::eraseSlot(size_t slot) {
+    // Backward-shift deletion, as in HashTable's RobinHood mode
+    size_t next = nextSlot(slot);
+    while (slots[next].node != EMPTY_NODE && distance(next) > 0) {
+        slots[slot] = slots[next];
+        slot = next;
+        next = nextSlot(next);
+    }
+    slots[slot].node = EMPTY_NODE;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::resize(size_t new_capacity) {
+    if (new_capacity < 1) {
+        new_capacity = 1;
+    }
+    
+    // Only the 8-byte slots move; nodes stay where they are
+    Slot* old_slots = slots;
+    size_t old_count = bucket_count;
+    bucket_count = new_capacity;
+    initializeSlots();
+    for (size_t i = 0; i < old_count; ++i) {
+        if (old_slots[i].node != EMPTY_NODE) {
+            placeSlot(old_slots[i]);
+        }
+    }
+    delete[] old_slots;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::needsResize() const {
+    return static_cast<double>(size + 1) > static_cast<double>(bucket_count) * MAX_LOAD_FACTOR;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename... Args>
+Value& NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::insertNew(uint32_t hash_value, Args&&... args) {
+    if (needsResize()) {
+        resize(Sizing::roundCapacity(bucket_count * 2));
+    }
+    uint32_t index = allocateNode(std::forward<Args>(args)...);
+    placeSlot(Slot{hash_value, index});
+    ++size;
+    return node(index).value;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::initializeSlots() {
+    slots = new Slot[bucket_count];
+    std::fill(slots, slots + bucket_count, Slot{0, EMPTY_NODE});
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::copyFrom(const NodeHashTable& other) {
+    // Slot positions depend only on the stored hashes, so they are copied as
+    // is; the nodes are packed into a fresh arena
+    bucket_count = other.bucket_count;
+    size = other.size;
+    initializeSlots();
+    for (size_t i = 0; i < bucket_count; ++i) {
+        if (other.slots[i].node != EMPTY_NODE) {
+            const Node& source = other.node(other.slots[i].node);
+            slots[i] = Slot{other.slots[i].hash, allocateNode(source.key, source.value)};
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::moveFrom(NodeHashTable&& other) {
+    slots = other.slots;
+    bucket_count = other.bucket_count;
+    size = other.size;
+    chunks = other.chunks;
+    chunk_count = other.chunk_count;
+    chunk_capacity = other.chunk_capacity;
+    node_count = other.node_count;
+    free_head = other.free_head;
+    
+    other.slots = nullptr;
+    other.bucket_count = 0;
+    other.size = 0;
+    other.chunks = nullptr;
+    other.chunk_count = 0;
+    other.chunk_capacity = 0;
+    other.node_count = 0;
+    other.free_head = EMPTY_NODE;
+}
+
+//==================== LOOKUP HELPERS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+Value* NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::findValue(const K& key) const {
+    size_t slot = findSlot(key);
+    return slot == bucket_count ? nullptr : &node(slots[slot].node).value;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+bool NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::removeKey(const K& key) {
+    size_t slot = findSlot(key);
+    if (slot == bucket_count) {
+        return false;
+    }
+    uint32_t index = slots[slot].node;
+    eraseSlot(slot);
+    freeNode(index);
+    --size;
+    return true;
+}
+
+//==================== CONSTRUCTORS AND DESTRUCTOR ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::NodeHashTable(size_t initial_capacity)
+    : slots(nullptr), bucket_count(0), size(0), chunks(nullptr), chunk_count(0), chunk_capacity(0),
+      node_count(0), free_head(EMPTY_NODE) {
+    bucket_count = Sizing::roundCapacity(initial_capacity);
+    initializeSlots();
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::NodeHashTable(const NodeHashTable& other)
+    : slots(nullptr), bucket_count(0), size(0), chunks(nullptr), chunk_count(0), chunk_capacity(0),
+      node_count(0), free_head(EMPTY_NODE) {
+    copyFrom(other);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::NodeHashTable(NodeHashTable&& other) noexcept
+    : slots(nullptr), bucket_count(0), size(0), chunks(nullptr), chunk_count(0), chunk_capacity(0),
+      node_count(0), free_head(EMPTY_NODE) {
+    moveFrom(std::move(other));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::~NodeHashTable() {
+    destroyNodes();
+    delete[] slots;
+}
+
+//==================== ASSIGNMENT OPERATORS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>& NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::operator=(const NodeHashTable& other) {
+    if (this != &other) {
+        destroyNodes();
+        delete[] slots;
+        copyFrom(other);
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>& NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::operator=(NodeHashTable&& other) noexcept {
+    if (this != &other) {
+        destroyNodes();
+        delete[] slots;
+        moveFrom(std::move(other));
+    }
+    return *this;
+}
+
+//==================== ELEMENT ACCESS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+Value& NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::operator[](const Key& key) {
+    Value* existing = findValue(key);
+    if (existing) {
+        return *existing;
+    }
+    return insertNew(hash(key), Key(key), Value());
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+Value& NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::operator[](Key&& key) {
+    Value* existing = findValue(key);
+    if (existing) {
+        return *existing;
+    }
+    uint32_t hash_value = hash(key);
+    return insertNew(hash_value, std::move(key), Value());
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+Value& NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::at(const Key& key) {
+    Value* existing = findValue(key);
+    if (!existing) {
+        throw std::out_of_range("Key not found");
+    }
+    return *existing;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+const Value& NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::at(const Key& key) const {
+    Value* existing = findValue(key);
+    if (!existing) {
+        throw std::out_of_range("Key not found");
+    }
+    return *existing;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::template IfTransparent<K, Value&>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::operator[](const K& key) {
+    Value* existing = findValue(key);
+    if (existing) {
+        return *existing;
+    }
+    return insertNew(hash(key), Key(key), Value());
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::template IfTransparent<K, Value&>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::at(const K& key) {
+    Value* existing = findValue(key);
+    if (!existing) {
+        throw std::out_of_range("Key not found");
+    }
+    return *existing;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::template IfTransparent<K, const Value&>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::at(const K& key) const {
+    Value* existing = findValue(key);
+    if (!existing) {
+        throw std::out_of_range("Key not found");
+    }
+    return *existing;
+}
+
+//==================== MODIFIERS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::insert(const Key& key, const Value& value) {
+    Value* existing = findValue(key);
+    if (existing) {
+        *existing = value;
+        return;
+    }
+    insertNew(hash(key), key, value);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::insert(Key&& key, Value&& value) {
+    Value* existing = findValue(key);
+    if (existing) {
+        *existing = std::move(value);
+        return;
+    }
+    uint32_t hash_value = hash(key);
+    insertNew(hash_value, std::move(key), std::move(value));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename... Args>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::emplace(const Key& key, Args&&... args) {
+    Value* existing = findValue(key);
+    if (existing) {
+        *existing = Value(std::forward<Args>(args)...);
+        return;
+    }
+    insertNew(hash(key), Key(key), Value(std::forward<Args>(args)...));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename... Args>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::emplace(Key&& key, Args&&... args) {
+    Value* existing = findValue(key);
+    if (existing) {
+        *existing = Value(std::forward<Args>(args)...);
+        return;
+    }
+    uint32_t hash_value = hash(key);
+    insertNew(hash_value, std::move(key), Value(std::forward<Args>(args)...));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::remove(const Key& key) {
+    return removeKey(key);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::template IfTransparent<K, bool>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::remove(const K& key) {
+    return removeKey(key);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::clear() {
+    // Keep the arena's chunks, every cell becomes unused again
+    for (size_t i = 0; i < bucket_count; ++i) {
+        if (slots[i].node != EMPTY_NODE) {
+            node(slots[i].node).~Node();
+            slots[i].node = EMPTY_NODE;
+        }
+    }
+    size = 0;
+    node_count = 0;
+    free_head = EMPTY_NODE;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::swap(NodeHashTable& other) {
+    std::swap(slots, other.slots);
+    std::swap(bucket_count, other.bucket_count);
+    std::swap(size, other.size);
+    std::swap(chunks, other.chunks);
+    std::swap(chunk_count, other.chunk_count);
+    std::swap(chunk_capacity, other.chunk_capacity);
+    std::swap(node_count, other.node_count);
+    std::swap(free_head, other.free_head);
+}
+
+//==================== LOOKUP OPERATIONS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::contains(const Key& key) const {
+    return findValue(key) != nullptr;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+Value* NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::find(const Key& key) {
+    return findValue(key);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+const Value* NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::find(const Key& key) const {
+    return findValue(key);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::template IfTransparent<K, bool>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::contains(const K& key) const {
+    return findValue(key) != nullptr;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::template IfTransparent<K, Value*>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::find(const K& key) {
+    return findValue(key);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename K>
+typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::template IfTransparent<K, const Value*>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::find(const K& key) const {
+    return findValue(key);
+}
+
+//==================== BULK OPERATIONS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+template<typename InputIterator>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::insertBulk(InputIterator first, InputIterator last) {
+    using Category = typename std::iterator_traits<InputIterator>::iterator_category;
+    if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value) {
+        reserve(size + static_cast<size_t>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) {
+        insert(first->first, first->second);
+    }
+}
+
+//==================== CAPACITY ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::getSize() const {
+    return size;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::empty() const {
+    return size == 0;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::getBucketCount() const {
+    return bucket_count;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+double NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::getLoadFactor() const {
+    return bucket_count ? static_cast<double>(size) / bucket_count : 0.0;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::getCollisionCount() const {
+    size_t collisions = 0;
+    for (size_t i = 0; i < bucket_count; ++i) {
+        if (slots[i].node != EMPTY_NODE && distance(i) != 0) {
+            ++collisions;
+        }
+    }
+    return collisions;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+size_t NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::getMaxProbeDistance() const {
+    size_t longest = 0;
+    for (size_t i = 0; i < bucket_count; ++i) {
+        if (slots[i].node != EMPTY_NODE) {
+            longest = std::max(longest, distance(i));
+        }
+    }
+    return longest;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+double NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::getMeanProbeDistance() const {
+    if (size == 0) {
+        return 0.0;
+    }
+    double total = 0.0;
+    for (size_t i = 0; i < bucket_count; ++i) {
+        if (slots[i].node != EMPTY_NODE) {
+            total += static_cast<double>(distance(i));
+        }
+    }
+    return total / size;
+}
+
+//==================== HASH TABLE OPERATIONS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::rehashToSize(size_t new_size) {
+    size_t minimum = static_cast<size_t>(size / MAX_LOAD_FACTOR) + 1;
+    resize(Sizing::roundCapacity(std::max(new_size, minimum)));
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::reserve(size_t min_capacity) {
+    size_t required = static_cast<size_t>(min_capacity / MAX_LOAD_FACTOR) + 1;
+    if (required > bucket_count) {
+        resize(Sizing::roundCapacity(required));
+    }
+}
+
+//==================== ITERATOR IMPLEMENTATION ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+void NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::findNextValid() {
+    while (current_index < table->bucket_count && table->slots[current_index].node == EMPTY_NODE) {
+        ++current_index;
+    }
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::Iterator() : table(nullptr), current_index(0) {}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::Iterator(const NodeHashTable* table, size_t start_index)
+    : table(table), current_index(start_index) {
+    findNextValid();
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Node& NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::operator*() const {
+    if (!table || current_index >= table->bucket_count) {
+        throw std::out_of_range("Iterator out of range");
+    }
+    return table->node(table->slots[current_index].node);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Node* NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::operator->() const {
+    return &**this;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator& NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::operator++() {
+    if (table && current_index < table->bucket_count) {
+        ++current_index;
+        findNextValid();
+    }
+    return *this;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::operator++(int) {
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::operator==(const Iterator& other) const {
+    return table == other.table && current_index == other.current_index;
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+bool NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator::operator!=(const Iterator& other) const {
+    return !(*this == other);
+}
+
+//==================== ITERATOR FUNCTIONS ====================
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::begin() {
+    return Iterator(this, 0);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::end() {
+    return Iterator(this, bucket_count);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+const typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::begin() const {
+    return Iterator(this, 0);
+}
+
+template<typename Key, typename Value, typename Sizing, typename Hash, typename KeyEqual>
+const typename NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::Iterator NodeHashTable<Key, Value, Sizing, Hash, KeyEqual>::end() const {
+    return Iterator(this, bucket_count);
+}
+
+#endif
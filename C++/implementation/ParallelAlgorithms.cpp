@@ -0,0 +1,176 @@
+//==================== PARALLEL ALGORITHMS IMPLEMENTATION ====================
+#ifndef PARALLEL_ALGORITHMS_CPP
+#define PARALLEL_ALGORITHMS_CPP
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include "../header/ParallelAlgorithms.h"
+#include "ThreadPool.cpp"
+#include "vectors.cpp"
+
+//==================== PRIVATE HELPER FUNCTIONS ====================
+
+inline size_t ParallelAlgorithms::chunkCount(size_t size, size_t per_thread, const ThreadPool& pool) {
+    return std::min(pool.getThreadCount() * per_thread, size / SERIAL_THRESHOLD);
+}
+
+inline size_t ParallelAlgorithms::chunkBegin(size_t size, size_t chunks, size_t chunk) {
+    return static_cast<size_t>(static_cast<unsigned long long>(size) * chunk / chunks);
+}
+
+template<typename T, typename Compare>
+void ParallelAlgorithms::findCut(const T* source, size_t low, size_t middle, size_t high, size_t piece, size_t pieces,
+                                 Compare& compare, size_t& left, size_t& right) {
+    // Cut the longer run evenly and find the matching cut in the other one;
+    // equal elements of the left run still come first, as in std::merge
+    if (piece == 0) {
+        left = low;
+        right = middle;
+    } else if (piece == pieces) {
+        left = middle;
+        right = high;
+    } else if (middle - low >= high - middle) {
+        left = low + (middle - low) * piece / pieces;
+        right = std::lower_bound(source + middle, source + high, source[left], compare) - source;
+    } else {
+        right = middle + (high - middle) * piece / pieces;
+        left = std::upper_bound(source + low, source + middle, source[right], compare) - source;
+    }
+}
+
+//==================== SORT ====================
+
+template<typename T, typename Compare>
+void ParallelAlgorithms::sort(T* data, size_t size, Compare compare, ThreadPool& pool) {
+    size_t chunks = chunkCount(size, 1, pool);
+    if (chunks <= 1) {
+        std::sort(data, data + size, compare);
+        return;
+    }
+    
+    pool.parallelFor(chunks, [&](size_t chunk) {
+        std::sort(data + chunkBegin(size, chunks, chunk), data + chunkBegin(size, chunks, chunk + 1), compare);
+    });
+    
+    DynamicArray<T> buffer;
+    buffer.resize(size);
+    T* source = data;
+    T* target = buffer.getData();
+    for (size_t width = 1; width < chunks; width *= 2) {
+        // Runs of width chunks merge in pairs; an unpaired last run is copied across
+        size_t pairs = (chunks + 2 * width - 1) / (2 * width);
+        size_t pieces = std::max<size_t>(1, 2 * pool.getThreadCount() / pairs);
+        auto runBegin = [&](size_t run) { return chunkBegin(size, chunks, std::min(chunks, run * width)); };
+        
+        // All cuts are found before any merge starts moving elements out of source
+        DynamicArray<size_t> left_cuts(pairs * (pieces + 1), 0);
+        DynamicArray<size_t> right_cuts(pairs * (pieces + 1), 0);
+        for (size_t pair = 0; pair < pairs; ++pair) {
+            for (size_t piece = 0; piece <= pieces; ++piece) {
+                size_t cut = pair * (pieces + 1) + piece;
+                findCut(source, runBegin(2 * pair), runBegin(2 * pair + 1), runBegin(2 * pair + 2), piece, pieces,
+                        compare, left_cuts[cut], right_cuts[cut]);
+            }
+        }
+        
+        pool.parallelFor(pairs * pieces, [&](size_t task) {
+            size_t cut = task / pieces * (pieces + 1) + task % pieces;
+            size_t middle = runBegin(2 * (task / pieces) + 1);
+            std::merge(std::make_move_iterator(source + left_cuts[cut]), std::make_move_iterator(source + left_cuts[cut + 1]),
+                       std::make_move_iterator(source + right_cuts[cut]), std::make_move_iterator(source + right_cuts[cut + 1]),
+                       target + left_cuts[cut] + (right_cuts[cut] - middle), compare);
+        });
+        std::swap(source, target);
+    }
+    
+    if (source != data) {
+        pool.parallelFor(chunks, [&](size_t chunk) {
+            std::move(source + chunkBegin(size, chunks, chunk), source + chunkBegin(size, chunks, chunk + 1),
+                      data + chunkBegin(size, chunks, chunk));
+        });
+    }
+}
+
+//==================== TRANSFORM ====================
+
+template<typename T, typename U, typename Function>
+void ParallelAlgorithms::transform(const T* input, size_t size, U* output, Function function, ThreadPool& pool) {
+    size_t chunks = std::max<size_t>(1, chunkCount(size, 4, pool));
+    pool.parallelFor(chunks, [&](size_t chunk) {
+        size_t end = chunkBegin(size, chunks, chunk + 1);
+        for (size_t i = chunkBegin(size, chunks, chunk); i < end; ++i) {
+            output[i] = function(input[i]);
+        }
+    });
+}
+
+//==================== REDUCE ====================
+
+template<typename T, typename Combine>
+T ParallelAlgorithms::reduce(const T* data, size_t size, T initial, Combine combine, ThreadPool& pool) {
+    size_t chunks = chunkCount(size, 4, pool);
+    if (chunks <= 1) {
+        for (size_t i = 0; i < size; ++i) {
+            initial = combine(initial, data[i]);
+        }
+        return initial;
+    }
+    
+    DynamicArray<T> partials(chunks, initial);
+    pool.parallelFor(chunks, [&](size_t chunk) {
+        size_t begin = chunkBegin(size, chunks, chunk);
+        size_t end = chunkBegin(size, chunks, chunk + 1);
+        T accumulator = data[begin];
+        for (size_t i = begin + 1; i < end; ++i) {
+            accumulator = combine(accumulator, data[i]);
+        }
+        partials[chunk] = std::move(accumulator);
+    });
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        initial = combine(initial, partials[chunk]);
+    }
+    return initial;
+}
+
+//==================== INCLUSIVE SCAN ====================
+
+template<typename T, typename Combine>
+void ParallelAlgorithms::inclusiveScan(const T* input, size_t size, T* output, Combine combine, ThreadPool& pool) {
+    size_t chunks = chunkCount(size, 4, pool);
+    if (chunks <= 1) {
+        for (size_t i = 0; i < size; ++i) {
+            output[i] = i == 0 ? input[0] : combine(output[i - 1], input[i]);
+        }
+        return;
+    }
+    
+    // Chunk totals in parallel, a short serial scan over them, then every
+    // chunk rescans its own elements starting from the preceding total
+    DynamicArray<T> totals(chunks, input[0]);
+    pool.parallelFor(chunks - 1, [&](size_t chunk) {
+        size_t begin = chunkBegin(size, chunks, chunk);
+        size_t end = chunkBegin(size, chunks, chunk + 1);
+        T accumulator = input[begin];
+        for (size_t i = begin + 1; i < end; ++i) {
+            accumulator = combine(accumulator, input[i]);
+        }
+        totals[chunk] = std::move(accumulator);
+    });
+    for (size_t chunk = 1; chunk + 1 < chunks; ++chunk) {
+        totals[chunk] = combine(totals[chunk - 1], totals[chunk]);
+    }
+    
+    pool.parallelFor(chunks, [&](size_t chunk) {
+        size_t begin = chunkBegin(size, chunks, chunk);
+        size_t end = chunkBegin(size, chunks, chunk + 1);
+        T accumulator = chunk == 0 ? input[begin] : combine(totals[chunk - 1], input[begin]);
+        output[begin] = accumulator;
+        for (size_t i = begin + 1; i < end; ++i) {
+            accumulator = combine(accumulator, input[i]);
+            output[i] = accumulator;
+        }
+    });
+}
+
+#endif
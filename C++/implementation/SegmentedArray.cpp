@@ -0,0 +1,510 @@
+//==================== SEGMENTED ARRAY IMPLEMENTATION ====================
+#ifndef SEGMENTED_ARRAY_CPP
+#define SEGMENTED_ARRAY_CPP
+
+#include <stdexcept>
+#include <new>
+#include <utility>
+#include "../header/SegmentedArray.h"
+#include "vectors.cpp"
+
+//==================== PRIVATE HELPER FUNCTIONS ====================
+
+template<typename T, size_t ChunkSize, typename Allocator>
+T* SegmentedArray<T, ChunkSize, Allocator>::slot(size_t index) const {
+    return chunks[index / ChunkSize] + index % ChunkSize;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+void SegmentedArray<T, ChunkSize, Allocator>::addChunk() {
+    T* chunk = AllocatorTraits::allocate(allocator(), ChunkSize);
+    try {
+        chunks.push_back(chunk);
+    } catch (...) {
+        AllocatorTraits::deallocate(allocator(), chunk, ChunkSize);
+        throw;
+    }
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+void SegmentedArray<T, ChunkSize, Allocator>::releaseChunks(size_t keep) {
+    // Frees the chunks past the first keep, which must hold no elements
+    while (chunks.getSize() > keep) {
+        AllocatorTraits::deallocate(allocator(), chunks.back(), ChunkSize);
+        chunks.pop_back();
+    }
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+void SegmentedArray<T, ChunkSize, Allocator>::destroyElements() {
+    for (size_t i = 0; i < size; ++i) {
+        slot(i)->~T();
+    }
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+Allocator& SegmentedArray<T, ChunkSize, Allocator>::allocator() {
+    return *this;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+const Allocator& SegmentedArray<T, ChunkSize, Allocator>::allocator() const {
+    return *this;
+}
+
+//==================== CONSTRUCTORS AND DESTRUCTOR ====================
+
+template<typename T, size_t ChunkSize, typename Allocator>
+SegmentedArray<T, ChunkSize, Allocator>::SegmentedArray() : Allocator(), chunks(), size(0) {}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+SegmentedArray<T, ChunkSize, Allocator>::SegmentedArray(const Allocator& allocator) : Allocator(allocator), chunks(), size(0) {}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+SegmentedArray<T, ChunkSize, Allocator>::SegmentedArray(const SegmentedArray& other)
+    : Allocator(AllocatorTraits::select_on_container_copy_construction(other)), chunks(), size(0) {
+    reserve(other.size);
+    for (size_t i = 0; i < other.size; ++i) {
+        push_back(other[i]);
+    }
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+SegmentedArray<T, ChunkSize, Allocator>::SegmentedArray(SegmentedArray&& other) noexcept
+    : Allocator(std::move(static_cast<Allocator&>(other))), chunks(std::move(other.chunks)), size(other.size) {
+    other.size = 0;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+SegmentedArray<T, ChunkSize, Allocator>::~SegmentedArray() {
+    destroyElements();
+    releaseChunks(0);
+}
+
+//==================== ASSIGNMENT OPERATORS ====================
+
+template<typename T, size_t ChunkSize, typename Allocator>
+SegmentedArray<T, ChunkSize, Allocator>& SegmentedArray<T, ChunkSize, Allocator>::operator=(const SegmentedArray& other) {
+    if (this != &other) {
+        clear();
+        if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value) {
+            // Chunks from the old allocator cannot be freed by the new one
+            if (!(allocator() == other.allocator())) {
+                releaseChunks(0);
+            }
+            allocator() = other.allocator();
+        }
+        reserve(other.size);
+        for (size_t i = 0; i < other.size; ++i) {
+            push_back(other[i]);
+        }
+    }
+    return *this;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+SegmentedArray<T, ChunkSize, Allocator>& SegmentedArray<T, ChunkSize, Allocator>::operator=(SegmentedArray&& other) noexcept(NOTHROW_MOVE_ASSIGN) {
+    if (this != &other) {
+        clear();
+        if (AllocatorTraits::propagate_on_container_move_assignment::value || allocator() == other.allocator()) {
+            // Chunks can change hands once this array's allocator can free them
+            releaseChunks(0);
+            if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+                allocator() = std::move(other.allocator());
+            }
+            chunks = std::move(other.chunks);
+            size = other.size;
+            other.size = 0;
+        } else if constexpr (!NOTHROW_MOVE_ASSIGN) {
+            // Memory from a different allocator cannot be adopted, move element
+            // by element into chunks of this array's own allocator
+            reserve(other.size);
+            for (size_t i = 0; i < other.size; ++i) {
+                push_back(std::move(other[i]));
+            }
+            other.clear();
+        }
+    }
+    return *this;
+}
+
+//==================== ELEMENT ACCESS ====================
+
+template<typename T, size_t ChunkSize, typename Allocator>
+T& SegmentedArray<T, ChunkSize, Allocator>::operator[](size_t index) {
+    return *slot(index);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+const T& SegmentedArray<T, ChunkSize, Allocator>::operator[](size_t index) const {
+    return *slot(index);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+T& SegmentedArray<T, ChunkSize, Allocator>::at(size_t index) {
+    if (index >= size) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    return *slot(index);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+const T& SegmentedArray<T, ChunkSize, Allocator>::at(size_t index) const {
+    if (index >= size) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    return *slot(index);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+T& SegmentedArray<T, ChunkSize, Allocator>::front() {
+    if (size == 0) {
+        throw std::runtime_error("Array is empty");
+    }
+    return *slot(0);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+const T& SegmentedArray<T, ChunkSize, Allocator>::front() const {
+    if (size == 0) {
+        throw std::runtime_error("Array is empty");
+    }
+    return *slot(0);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+T& SegmentedArray<T, ChunkSize, Allocator>::back() {
+    if (size == 0) {
+        throw std::runtime_error("Array is empty");
+    }
+    return *slot(size - 1);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+const T& SegmentedArray<T, ChunkSize, Allocator>::back() const {
+    if (size == 0) {
+        throw std::runtime_error("Array is empty");
+    }
+    return *slot(size - 1);
+}
+
+//==================== CAPACITY FUNCTIONS ====================
+
+template<typename T, size_t ChunkSize, typename Allocator>
+size_t SegmentedArray<T, ChunkSize, Allocator>::getSize() const {
+    return size;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+size_t SegmentedArray<T, ChunkSize, Allocator>::getCapacity() const {
+    return chunks.getSize() * ChunkSize;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+size_t SegmentedArray<T, ChunkSize, Allocator>::getChunkCount() const {
+    return chunks.getSize();
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+bool SegmentedArray<T, ChunkSize, Allocator>::empty() const {
+    return size == 0;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+void SegmentedArray<T, ChunkSize, Allocator>::reserve(size_t new_capacity) {
+    chunks.reserve((new_capacity + ChunkSize - 1) / ChunkSize);
+    while (getCapacity() < new_capacity) {
+        addChunk();
+    }
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+void SegmentedArray<T, ChunkSize, Allocator>::shrinkToFit() {
+    releaseChunks((size + ChunkSize - 1) / ChunkSize);
+    chunks.shrinkToFit();
+}
+
+//==================== MODIFIERS ====================
+
+template<typename T, size_t ChunkSize, typename Allocator>
+void SegmentedArray<T, ChunkSize, Allocator>::push_back(const T& value) {
+    // Existing elements never move, so value may safely refer into this array
+    if (size == getCapacity()) {
+        addChunk();
+    }
+    new (slot(size)) T(value);
+    ++size;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+void SegmentedArray<T, ChunkSize, Allocator>::push_back(T&& value) {
+    if (size == getCapacity()) {
+        addChunk();
+    }
+    new (slot(size)) T(std::move(value));
+    ++size;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+template<typename... Args>
+T& SegmentedArray<T, ChunkSize, Allocator>::emplace_back(Args&&... args) {
+    if (size == getCapacity()) {
+        addChunk();
+    }
+    T* element = new (slot(size)) T(std::forward<Args>(args)...);
+    ++size;
+    return *element;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+void SegmentedArray<T, ChunkSize, Allocator>::pop_back() {
+    if (size == 0) {
+        throw std::runtime_error("Array is empty");
+    }
+    slot(--size)->~T();
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+void SegmentedArray<T, ChunkSize, Allocator>::clear() {
+    destroyElements();
+    size = 0;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+void SegmentedArray<T, ChunkSize, Allocator>::swap(SegmentedArray& other) {
+    using std::swap;
+    swap(static_cast<Allocator&>(*this), static_cast<Allocator&>(other));
+    chunks.swap(other.chunks);
+    swap(size, other.size);
+}
+
+//==================== ITERATOR IMPLEMENTATION ====================
+
+template<typename T, size_t ChunkSize, typename Allocator>
+SegmentedArray<T, ChunkSize, Allocator>::Iterator::Iterator(SegmentedArray* array, size_t index) : array(array), index(index) {}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+T& SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator*() const {
+    return (*array)[index];
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+T* SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator->() const {
+    return &(*array)[index];
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+T& SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator[](size_t n) const {
+    return (*array)[index + n];
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::Iterator& SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator++() {
+    ++index;
+    return *this;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::Iterator SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator++(int) {
+    Iterator temp = *this;
+    ++index;
+    return temp;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::Iterator& SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator--() {
+    --index;
+    return *this;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::Iterator SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator--(int) {
+    Iterator temp = *this;
+    --index;
+    return temp;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::Iterator SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator+(size_t n) const {
+    return Iterator(array, index + n);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::Iterator SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator-(size_t n) const {
+    return Iterator(array, index - n);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::Iterator& SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator+=(size_t n) {
+    index += n;
+    return *this;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::Iterator& SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator-=(size_t n) {
+    index -= n;
+    return *this;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+ptrdiff_t SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator-(const Iterator& other) const {
+    return static_cast<ptrdiff_t>(index) - static_cast<ptrdiff_t>(other.index);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+bool SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator==(const Iterator& other) const {
+    return array == other.array && index == other.index;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+bool SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator!=(const Iterator& other) const {
+    return !(*this == other);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+bool SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator<(const Iterator& other) const {
+    return index < other.index;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+bool SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator>(const Iterator& other) const {
+    return index > other.index;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+bool SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator<=(const Iterator& other) const {
+    return index <= other.index;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+bool SegmentedArray<T, ChunkSize, Allocator>::Iterator::operator>=(const Iterator& other) const {
+    return index >= other.index;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::ConstIterator(const SegmentedArray* array, size_t index) : array(array), index(index) {}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::ConstIterator(const Iterator& other) : array(other.array), index(other.index) {}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+const T& SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator*() const {
+    return (*array)[index];
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+const T* SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator->() const {
+    return &(*array)[index];
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+const T& SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator[](size_t n) const {
+    return (*array)[index + n];
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::ConstIterator& SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator++() {
+    ++index;
+    return *this;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::ConstIterator SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator++(int) {
+    ConstIterator temp = *this;
+    ++index;
+    return temp;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::ConstIterator& SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator--() {
+    --index;
+    return *this;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::ConstIterator SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator--(int) {
+    ConstIterator temp = *this;
+    --index;
+    return temp;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::ConstIterator SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator+(size_t n) const {
+    return ConstIterator(array, index + n);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::ConstIterator SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator-(size_t n) const {
+    return ConstIterator(array, index - n);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::ConstIterator& SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator+=(size_t n) {
+    index += n;
+    return *this;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::ConstIterator& SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator-=(size_t n) {
+    index -= n;
+    return *this;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+ptrdiff_t SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator-(const ConstIterator& other) const {
+    return static_cast<ptrdiff_t>(index) - static_cast<ptrdiff_t>(other.index);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+bool SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator==(const ConstIterator& other) const {
+    return array == other.array && index == other.index;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+bool SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator!=(const ConstIterator& other) const {
+    return !(*this == other);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+bool SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator<(const ConstIterator& other) const {
+    return index < other.index;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+bool SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator>(const ConstIterator& other) const {
+    return index > other.index;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+bool SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator<=(const ConstIterator& other) const {
+    return index <= other.index;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+bool SegmentedArray<T, ChunkSize, Allocator>::ConstIterator::operator>=(const ConstIterator& other) const {
+    return index >= other.index;
+}
+
+//==================== ITERATOR FUNCTIONS ====================
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::Iterator SegmentedArray<T, ChunkSize, Allocator>::begin() {
+    return Iterator(this, 0);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::Iterator SegmentedArray<T, ChunkSize, Allocator>::end() {
+    return Iterator(this, size);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::ConstIterator SegmentedArray<T, ChunkSize, Allocator>::begin() const {
+    return ConstIterator(this, 0);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator>
+typename SegmentedArray<T, ChunkSize, Allocator>::ConstIterator SegmentedArray<T, ChunkSize, Allocator>::end() const {
+    return ConstIterator(this, size);
+}
+
+#endif
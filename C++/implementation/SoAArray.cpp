@@ -0,0 +1,496 @@
+//==================== STRUCTURE OF ARRAYS IMPLEMENTATION ====================
+#ifndef SOA_ARRAY_CPP
+#define SOA_ARRAY_CPP
+
+#include <stdexcept>
+#include <utility>
+#include "../header/SoAArray.h"
+#include "vectors.cpp"
+
+//==================== REFERENCE PROXIES ====================
+
+template<typename... Fields>
+SoAArray<Fields...>::Reference::Reference(SoAArray* array, size_t index) : array(array), index(index) {}
+
+template<typename... Fields>
+template<size_t I>
+typename SoAArray<Fields...>::template FieldType<I>& SoAArray<Fields...>::Reference::get() const {
+    return std::get<I>(array->columns)[index];
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Reference& SoAArray<Fields...>::Reference::operator=(const Value& value) {
+    array->assignRow(std::index_sequence_for<Fields...>(), index, value);
+    return *this;
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Reference& SoAArray<Fields...>::Reference::operator=(const Reference& other) {
+    // Assigns the element, not the proxy
+    return *this = static_cast<Value>(other);
+}
+
+template<typename... Fields>
+SoAArray<Fields...>::Reference::operator Value() const {
+    return array->loadRow(std::index_sequence_for<Fields...>(), index);
+}
+
+template<typename... Fields>
+void SoAArray<Fields...>::Reference::swap(const Reference& other) const {
+    // Swaps field by field, without materializing either row as a Value
+    array->swapRows(std::index_sequence_for<Fields...>(), index, other.index);
+}
+
+template<typename... Fields>
+SoAArray<Fields...>::ConstReference::ConstReference(const SoAArray* array, size_t index) : array(array), index(index) {}
+
+template<typename... Fields>
+template<size_t I>
+const typename SoAArray<Fields...>::template FieldType<I>& SoAArray<Fields...>::ConstReference::get() const {
+    return std::get<I>(array->columns)[index];
+}
+
+template<typename... Fields>
+SoAArray<Fields...>::ConstReference::operator Value() const {
+    return array->loadRow(std::index_sequence_for<Fields...>(), index);
+}
+
+//==================== PRIVATE HELPER FUNCTIONS ====================
+
+template<typename... Fields>
+template<typename... Args, size_t... I>
+void SoAArray<Fields...>::pushColumns(std::index_sequence<I...>, Args&&... values) {
+    // Capacity is already there, so only a throwing field constructor can fail;
+    // the columns filled before it are rolled back
+    size_t pushed = 0;
+    try {
+        ((std::get<I>(columns).push_back(std::forward<Args>(values)), ++pushed), ...);
+    } catch (...) {
+        popColumns(std::index_sequence_for<Fields...>(), pushed);
+        throw;
+    }
+}
+
+template<typename... Fields>
+template<size_t... I>
+void SoAArray<Fields...>::popColumns(std::index_sequence<I...>, size_t count) {
+    ((I < count ? std::get<I>(columns).pop_back() : void()), ...);
+}
+
+template<typename... Fields>
+template<size_t... I>
+void SoAArray<Fields...>::assignRow(std::index_sequence<I...>, size_t index, const Value& value) {
+    ((std::get<I>(columns)[index] = std::get<I>(value)), ...);
+}
+
+template<typename... Fields>
+template<size_t... I>
+typename SoAArray<Fields...>::Value SoAArray<Fields...>::loadRow(std::index_sequence<I...>, size_t index) const {
+    return Value(std::get<I>(columns)[index]...);
+}
+
+template<typename... Fields>
+template<size_t... I>
+void SoAArray<Fields...>::swapRows(std::index_sequence<I...>, size_t first, size_t second) {
+    using std::swap;
+    (swap(std::get<I>(columns)[first], std::get<I>(columns)[second]), ...);
+}
+
+template<typename... Fields>
+template<typename Function>
+void SoAArray<Fields...>::forEachColumn(Function&& function) {
+    std::apply([&](auto&... column) { (function(column), ...); }, columns);
+}
+
+template<typename... Fields>
+void SoAArray<Fields...>::growIfFull() {
+    // Grow every column together so they share one capacity
+    if (size == getCapacity()) {
+        reserve(DoublingGrowth::grow(size, size + 1));
+    }
+}
+
+//==================== CONSTRUCTORS ====================
+
+template<typename... Fields>
+SoAArray<Fields...>::SoAArray() : columns(), size(0) {}
+
+template<typename... Fields>
+SoAArray<Fields...>::SoAArray(size_t initial_capacity) : columns(), size(0) {
+    reserve(initial_capacity);
+}
+
+//==================== ELEMENT ACCESS ====================
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Reference SoAArray<Fields...>::operator[](size_t index) {
+    return Reference(this, index);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstReference SoAArray<Fields...>::operator[](size_t index) const {
+    return ConstReference(this, index);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Reference SoAArray<Fields...>::at(size_t index) {
+    if (index >= size) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    return Reference(this, index);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstReference SoAArray<Fields...>::at(size_t index) const {
+    if (index >= size) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    return ConstReference(this, index);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Reference SoAArray<Fields...>::front() {
+    if (size == 0) {
+        throw std::runtime_error("Array is empty");
+    }
+    return Reference(this, 0);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstReference SoAArray<Fields...>::front() const {
+    if (size == 0) {
+        throw std::runtime_error("Array is empty");
+    }
+    return ConstReference(this, 0);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Reference SoAArray<Fields...>::back() {
+    if (size == 0) {
+        throw std::runtime_error("Array is empty");
+    }
+    return Reference(this, size - 1);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstReference SoAArray<Fields...>::back() const {
+    if (size == 0) {
+        throw std::runtime_error("Array is empty");
+    }
+    return ConstReference(this, size - 1);
+}
+
+template<typename... Fields>
+template<size_t I>
+typename SoAArray<Fields...>::template FieldType<I>* SoAArray<Fields...>::column() {
+    return std::get<I>(columns).getData();
+}
+
+template<typename... Fields>
+template<size_t I>
+const typename SoAArray<Fields...>::template FieldType<I>* SoAArray<Fields...>::column() const {
+    return std::get<I>(columns).getData();
+}
+
+//==================== CAPACITY FUNCTIONS ====================
+
+template<typename... Fields>
+size_t SoAArray<Fields...>::getSize() const {
+    return size;
+}
+
+template<typename... Fields>
+size_t SoAArray<Fields...>::getCapacity() const {
+    return std::get<0>(columns).getCapacity();
+}
+
+template<typename... Fields>
+bool SoAArray<Fields...>::empty() const {
+    return size == 0;
+}
+
+template<typename... Fields>
+void SoAArray<Fields...>::reserve(size_t new_capacity) {
+    forEachColumn([&](auto& column) { column.reserve(new_capacity); });
+}
+
+template<typename... Fields>
+void SoAArray<Fields...>::shrinkToFit() {
+    forEachColumn([](auto& column) { column.shrinkToFit(); });
+}
+
+//==================== MODIFIERS ====================
+
+template<typename... Fields>
+template<typename... Args, typename>
+void SoAArray<Fields...>::push_back(Args&&... values) {
+    growIfFull();
+    pushColumns(std::index_sequence_for<Fields...>(), std::forward<Args>(values)...);
+    ++size;
+}
+
+template<typename... Fields>
+void SoAArray<Fields...>::push_back(const Value& value) {
+    std::apply([this](const Fields&... fields) { push_back(fields...); }, value);
+}
+
+template<typename... Fields>
+void SoAArray<Fields...>::pop_back() {
+    if (size == 0) {
+        throw std::runtime_error("Array is empty");
+    }
+    forEachColumn([](auto& column) { column.pop_back(); });
+    --size;
+}
+
+template<typename... Fields>
+void SoAArray<Fields...>::erase(size_t index) {
+    if (index >= size) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    forEachColumn([&](auto& column) { column.erase(index); });
+    --size;
+}
+
+template<typename... Fields>
+void SoAArray<Fields...>::erase(size_t start_index, size_t end_index) {
+    // Removes [start_index, end_index)
+    if (start_index > end_index || end_index > size) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    forEachColumn([&](auto& column) { column.erase(start_index, end_index); });
+    size -= end_index - start_index;
+}
+
+template<typename... Fields>
+void SoAArray<Fields...>::clear() {
+    forEachColumn([](auto& column) { column.clear(); });
+    size = 0;
+}
+
+template<typename... Fields>
+void SoAArray<Fields...>::swap(SoAArray& other) {
+    columns.swap(other.columns);
+    std::swap(size, other.size);
+}
+
+//==================== ITERATOR IMPLEMENTATION ====================
+
+template<typename... Fields>
+SoAArray<Fields...>::Iterator::Iterator(SoAArray* array, size_t index) : array(array), index(index) {}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Reference SoAArray<Fields...>::Iterator::operator*() const {
+    return Reference(array, index);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Reference SoAArray<Fields...>::Iterator::operator[](size_t n) const {
+    return Reference(array, index + n);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Iterator& SoAArray<Fields...>::Iterator::operator++() {
+    ++index;
+    return *this;
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Iterator SoAArray<Fields...>::Iterator::operator++(int) {
+    Iterator temp = *this;
+    ++index;
+    return temp;
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Iterator& SoAArray<Fields...>::Iterator::operator--() {
+    --index;
+    return *this;
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Iterator SoAArray<Fields...>::Iterator::operator--(int) {
+    Iterator temp = *this;
+    --index;
+    return temp;
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Iterator SoAArray<Fields...>::Iterator::operator+(size_t n) const {
+    return Iterator(array, index + n);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Iterator SoAArray<Fields...>::Iterator::operator-(size_t n) const {
+    return Iterator(array, index - n);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Iterator& SoAArray<Fields...>::Iterator::operator+=(size_t n) {
+    index += n;
+    return *this;
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Iterator& SoAArray<Fields...>::Iterator::operator-=(size_t n) {
+    index -= n;
+    return *this;
+}
+
+template<typename... Fields>
+ptrdiff_t SoAArray<Fields...>::Iterator::operator-(const Iterator& other) const {
+    return static_cast<ptrdiff_t>(index) - static_cast<ptrdiff_t>(other.index);
+}
+
+template<typename... Fields>
+bool SoAArray<Fields...>::Iterator::operator==(const Iterator& other) const {
+    return array == other.array && index == other.index;
+}
+
+template<typename... Fields>
+bool SoAArray<Fields...>::Iterator::operator!=(const Iterator& other) const {
+    return !(*this == other);
+}
+
+template<typename... Fields>
+bool SoAArray<Fields...>::Iterator::operator<(const Iterator& other) const {
+    return index < other.index;
+}
+
+template<typename... Fields>
+bool SoAArray<Fields...>::Iterator::operator>(const Iterator& other) const {
+    return index > other.index;
+}
+
+template<typename... Fields>
+bool SoAArray<Fields...>::Iterator::operator<=(const Iterator& other) const {
+    return index <= other.index;
+}
+
+template<typename... Fields>
+bool SoAArray<Fields...>::Iterator::operator>=(const Iterator& other) const {
+    return index >= other.index;
+}
+
+template<typename... Fields>
+SoAArray<Fields...>::ConstIterator::ConstIterator(const SoAArray* array, size_t index) : array(array), index(index) {}
+
+template<typename... Fields>
+SoAArray<Fields...>::ConstIterator::ConstIterator(const Iterator& other) : array(other.array), index(other.index) {}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstReference SoAArray<Fields...>::ConstIterator::operator*() const {
+    return ConstReference(array, index);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstReference SoAArray<Fields...>::ConstIterator::operator[](size_t n) const {
+    return ConstReference(array, index + n);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstIterator& SoAArray<Fields...>::ConstIterator::operator++() {
+    ++index;
+    return *this;
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstIterator SoAArray<Fields...>::ConstIterator::operator++(int) {
+    ConstIterator temp = *this;
+    ++index;
+    return temp;
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstIterator& SoAArray<Fields...>::ConstIterator::operator--() {
+    --index;
+    return *this;
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstIterator SoAArray<Fields...>::ConstIterator::operator--(int) {
+    ConstIterator temp = *this;
+    --index;
+    return temp;
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstIterator SoAArray<Fields...>::ConstIterator::operator+(size_t n) const {
+    return ConstIterator(array, index + n);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstIterator SoAArray<Fields...>::ConstIterator::operator-(size_t n) const {
+    return ConstIterator(array, index - n);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstIterator& SoAArray<Fields...>::ConstIterator::operator+=(size_t n) {
+    index += n;
+    return *this;
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstIterator& SoAArray<Fields...>::ConstIterator::operator-=(size_t n) {
+    index -= n;
+    return *this;
+}
+
+template<typename... Fields>
+ptrdiff_t SoAArray<Fields...>::ConstIterator::operator-(const ConstIterator& other) const {
+    return static_cast<ptrdiff_t>(index) - static_cast<ptrdiff_t>(other.index);
+}
+
+template<typename... Fields>
+bool SoAArray<Fields...>::ConstIterator::operator==(const ConstIterator& other) const {
+    return array == other.array && index == other.index;
+}
+
+template<typename... Fields>
+bool SoAArray<Fields...>::ConstIterator::operator!=(const ConstIterator& other) const {
+    return !(*this == other);
+}
+
+template<typename... Fields>
+bool SoAArray<Fields...>::ConstIterator::operator<(const ConstIterator& other) const {
+    return index < other.index;
+}
+
+template<typename... Fields>
+bool SoAArray<Fields...>::ConstIterator::operator>(const ConstIterator& other) const {
+    return index > other.index;
+}
+
+template<typename... Fields>
+bool SoAArray<Fields...>::ConstIterator::operator<=(const ConstIterator& other) const {
+    return index <= other.index;
+}
+
+template<typename... Fields>
+bool SoAArray<Fields...>::ConstIterator::operator>=(const ConstIterator& other) const {
+    return index >= other.index;
+}
+
+//==================== ITERATOR FUNCTIONS ====================
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Iterator SoAArray<Fields...>::begin() {
+    return Iterator(this, 0);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::Iterator SoAArray<Fields...>::end() {
+    return Iterator(this, size);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstIterator SoAArray<Fields...>::begin() const {
+    return ConstIterator(this, 0);
+}
+
+template<typename... Fields>
+typename SoAArray<Fields...>::ConstIterator SoAArray<Fields...>::end() const {
+    return ConstIterator(this, size);
+}
+
+#endif
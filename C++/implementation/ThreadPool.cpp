@@ -0,0 +1,163 @@
+//==================== THREAD POOL IMPLEMENTATION ====================
+#ifndef THREAD_POOL_CPP
+#define THREAD_POOL_CPP
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+#include "../header/ThreadPool.h"
+
+inline thread_local ThreadPool* ThreadPool::current_pool = nullptr;
+inline thread_local size_t ThreadPool::current_queue = 0;
+
+//==================== PRIVATE HELPER FUNCTIONS ====================
+
+inline void ThreadPool::submit(Task task) {
+    WorkQueue& queue = queues[homeQueue()];
+    {
+        std::lock_guard<std::mutex> guard(queue.lock);
+        queue.tasks.push_back(std::move(task));
+    }
+    {
+        // Raised under the sleep lock so a worker about to wait cannot miss it
+        std::lock_guard<std::mutex> guard(sleep_lock);
+        pending.fetch_add(1);
+    }
+    wake.notify_one();
+}
+
+inline bool ThreadPool::popTask(size_t queue, bool steal, Task& task) {
+    WorkQueue& work = queues[queue];
+    std::lock_guard<std::mutex> guard(work.lock);
+    if (work.tasks.empty()) {
+        return false;
+    }
+    if (steal) {
+        task = std::move(work.tasks.front());
+        work.tasks.pop_front();
+    } else {
+        task = std::move(work.tasks.back());
+        work.tasks.pop_back();
+    }
+    return true;
+}
+
+inline bool ThreadPool::runPendingTask(size_t home) {
+    // Own queue newest first, then steal the oldest task of the others
+    Task task;
+    bool found = popTask(home, false, task);
+    for (size_t offset = 1; !found && offset < thread_count; ++offset) {
+        found = popTask((home + offset) % thread_count, true, task);
+    }
+    if (!found) {
+        return false;
+    }
+    pending.fetch_sub(1);
+    task();
+    return true;
+}
+
+inline size_t ThreadPool::homeQueue() const {
+    return current_pool == this ? current_queue : thread_count - 1;
+}
+
+inline void ThreadPool::workerLoop(size_t index) {
+    current_pool = this;
+    current_queue = index;
+    while (true) {
+        if (runPendingTask(index)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> guard(sleep_lock);
+        wake.wait(guard, [this] { return stopping || pending.load() > 0; });
+        if (stopping && pending.load() <= 0) {
+            return;
+        }
+    }
+}
+
+//==================== CONSTRUCTORS AND DESTRUCTOR ====================
+
+inline ThreadPool::ThreadPool(size_t thread_count)
+    : queues(nullptr), workers(nullptr), thread_count(thread_count), pending(0), stopping(false) {
+    if (this->thread_count == 0) {
+        this->thread_count = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    queues = new WorkQueue[this->thread_count];
+    workers = new std::thread[this->thread_count - 1];
+    for (size_t i = 0; i + 1 < this->thread_count; ++i) {
+        workers[i] = std::thread(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+inline ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> guard(sleep_lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (size_t i = 0; i + 1 < thread_count; ++i) {
+        workers[i].join();
+    }
+    delete[] workers;
+    delete[] queues;
+}
+
+//==================== PARALLEL LOOP ====================
+
+template<typename Function>
+void ThreadPool::parallelFor(size_t count, Function&& function) {
+    if (count == 0) {
+        return;
+    }
+    if (count == 1 || thread_count == 1) {
+        for (size_t i = 0; i < count; ++i) {
+            function(i);
+        }
+        return;
+    }
+    
+    std::atomic<size_t> remaining(count);
+    std::exception_ptr error;
+    std::mutex error_lock;
+    auto run = [&](size_t i) {
+        try {
+            function(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> guard(error_lock);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+        remaining.fetch_sub(1, std::memory_order_release);
+    };
+    
+    for (size_t i = 1; i < count; ++i) {
+        submit([&run, i] { run(i); });
+    }
+    run(0);
+    
+    // Help with whatever is queued, ours or not, until the last task finishes
+    size_t home = homeQueue();
+    while (remaining.load(std::memory_order_acquire) > 0) {
+        if (!runPendingTask(home)) {
+            std::this_thread::yield();
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+//==================== ACCESSORS ====================
+
+inline size_t ThreadPool::getThreadCount() const {
+    return thread_count;
+}
+
+inline ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+#endif
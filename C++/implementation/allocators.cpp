@@ -0,0 +1,281 @@
+//==================== ALLOCATORS IMPLEMENTATION ====================
+#ifndef ALLOCATORS_CPP
+#define ALLOCATORS_CPP
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include "../header/allocators.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+//==================== ARENA ====================
+
+inline char* Arena::blockData(Block* block) {
+    // Header is padded so the first allocation is aligned for any fundamental type
+    return reinterpret_cast<char*>(block) + BLOCK_HEADER;
+}
+
+inline Arena::Block* Arena::addBlock(size_t min_bytes) {
+    size_t capacity = std::max(block_size, min_bytes);
+    void* memory = ::operator new(BLOCK_HEADER + capacity);
+    Block* block = static_cast<Block*>(memory);
+    block->next = head;
+    block->capacity = capacity;
+    block->used = 0;
+    head = block;
+    bytes_allocated += capacity;
+    return block;
+}
+
+inline void Arena::releaseBlocks(Block* first) {
+    while (first) {
+        Block* next = first->next;
+        ::operator delete(first);
+        first = next;
+    }
+}
+
+inline Arena::Arena(size_t block_size) : head(nullptr), block_size(block_size), bytes_allocated(0) {}
+
+inline Arena::~Arena() {
+    releaseBlocks(head);
+}
+
+inline void* Arena::allocate(size_t bytes, size_t alignment) {
+    if (head) {
+        uintptr_t start = reinterpret_cast<uintptr_t>(blockData(head)) + head->used;
+        uintptr_t aligned = (start + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        size_t end = static_cast<size_t>(aligned - reinterpret_cast<uintptr_t>(blockData(head))) + bytes;
+        if (end <= head->capacity) {
+            head->used = end;
+            return reinterpret_cast<void*>(aligned);
+        }
+    }
+    
+    // A fresh block always fits once the worst-case alignment padding is added
+    addBlock(bytes + alignment);
+    return allocate(bytes, alignment);
+}
+
+inline bool Arena::release(void* pointer, size_t bytes) {
+    if (!head || !pointer) {
+        return false;
+    }
+    char* end = blockData(head) + head->used;
+    if (static_cast<char*>(pointer) + bytes != end) {
+        return false;
+    }
+    head->used = static_cast<size_t>(static_cast<char*>(pointer) - blockData(head));
+    return true;
+}
+
+inline void Arena::reset() {
+    if (!head) {
+        return;
+    }
+    releaseBlocks(head->next);
+    head->next = nullptr;
+    head->used = 0;
+    bytes_allocated = head->capacity;
+}
+
+inline size_t Arena::getBytesAllocated() const {
+    return bytes_allocated;
+}
+
+//==================== MEMORY POOL ====================
+
+inline size_t MemoryPool::sizeClass(size_t bytes) {
+    size_t size_class = 0;
+    while ((size_t(1) << (size_class + MIN_CLASS_SHIFT)) < bytes) {
+        ++size_class;
+    }
+    return size_class;
+}
+
+inline MemoryPool::MemoryPool(size_t block_size) : arena(block_size) {
+    std::fill(free_lists, free_lists + CLASS_COUNT, nullptr);
+}
+
+inline void* MemoryPool::allocate(size_t bytes) {
+    size_t size_class = sizeClass(std::max(bytes, sizeof(FreeNode)));
+    if (size_class >= CLASS_COUNT) {
+        throw std::bad_alloc();
+    }
+    FreeNode* node = free_lists[size_class];
+    if (node) {
+        free_lists[size_class] = node->next;
+        return node;
+    }
+    return arena.allocate(size_t(1) << (size_class + MIN_CLASS_SHIFT), alignof(std::max_align_t));
+}
+
+inline void MemoryPool::deallocate(void* pointer, size_t bytes) {
+    if (!pointer) {
+        return;
+    }
+    size_t size_class = sizeClass(std::max(bytes, sizeof(FreeNode)));
+    FreeNode* node = static_cast<FreeNode*>(pointer);
+    node->next = free_lists[size_class];
+    free_lists[size_class] = node;
+}
+
+inline void MemoryPool::reset() {
+    arena.reset();
+    std::fill(free_lists, free_lists + CLASS_COUNT, nullptr);
+}
+
+inline size_t MemoryPool::getBytesAllocated() const {
+    return arena.getBytesAllocated();
+}
+
+//==================== ARENA ALLOCATOR ====================
+
+template<typename T>
+ArenaAllocator<T>::ArenaAllocator(Arena& arena) noexcept : arena(&arena) {}
+
+template<typename T>
+template<typename U>
+ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+template<typename T>
+T* ArenaAllocator<T>::allocate(size_t count) {
+    if (count > std::numeric_limits<size_t>::max() / sizeof(T)) {
+        throw std::bad_alloc();
+    }
+    return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+}
+
+template<typename T>
+void ArenaAllocator<T>::deallocate(T* pointer, size_t count) noexcept {
+    // Only the most recent allocation is given back, the rest waits for reset()
+    arena->release(pointer, count * sizeof(T));
+}
+
+template<typename T>
+Arena* ArenaAllocator<T>::getArena() const {
+    return arena;
+}
+
+template<typename T>
+template<typename U>
+bool ArenaAllocator<T>::operator==(const ArenaAllocator<U>& other) const {
+    return arena == other.arena;
+}
+
+template<typename T>
+template<typename U>
+bool ArenaAllocator<T>::operator!=(const ArenaAllocator<U>& other) const {
+    return arena != other.arena;
+}
+
+//==================== POOL ALLOCATOR ====================
+
+template<typename T>
+PoolAllocator<T>::PoolAllocator(MemoryPool& pool) noexcept : pool(&pool) {}
+
+template<typename T>
+template<typename U>
+PoolAllocator<T>::PoolAllocator(const PoolAllocator<U>& other) noexcept : pool(other.pool) {}
+
+template<typename T>
+T* PoolAllocator<T>::allocate(size_t count) {
+    if (count > std::numeric_limits<size_t>::max() / sizeof(T)) {
+        throw std::bad_alloc();
+    }
+    static_assert(alignof(T) <= alignof(std::max_align_t), "PoolAllocator does not support over-aligned types");
+    return static_cast<T*>(pool->allocate(count * sizeof(T)));
+}
+
+template<typename T>
+void PoolAllocator<T>::deallocate(T* pointer, size_t count) noexcept {
+    pool->deallocate(pointer, count * sizeof(T));
+}
+
+template<typename T>
+MemoryPool* PoolAllocator<T>::getPool() const {
+    return pool;
+}
+
+template<typename T>
+template<typename U>
+bool PoolAllocator<T>::operator==(const PoolAllocator<U>& other) const {
+    return pool == other.pool;
+}
+
+template<typename T>
+template<typename U>
+bool PoolAllocator<T>::operator!=(const PoolAllocator<U>& other) const {
+    return pool != other.pool;
+}
+
+//==================== HUGE PAGE ALLOCATOR ====================
+
+template<typename T>
+HugePageAllocator<T>::HugePageAllocator() noexcept {}
+
+template<typename T>
+template<typename U>
+HugePageAllocator<T>::HugePageAllocator(const HugePageAllocator<U>&) noexcept {}
+
+template<typename T>
+T* HugePageAllocator<T>::allocate(size_t count) {
+    if (count > std::numeric_limits<size_t>::max() / sizeof(T)) {
+        throw std::bad_alloc();
+    }
+    size_t bytes = count * sizeof(T);
+#if defined(__linux__)
+    if (bytes >= HUGE_PAGE_SIZE) {
+        // Over-map by one huge page, then trim so the mapping starts on a 2 MB boundary
+        size_t rounded = (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+        void* raw = mmap(nullptr, rounded + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+        uintptr_t aligned = (start + HUGE_PAGE_SIZE - 1) & ~(static_cast<uintptr_t>(HUGE_PAGE_SIZE) - 1);
+        if (aligned > start) {
+            munmap(raw, aligned - start);
+        }
+        size_t tail = (start + rounded + HUGE_PAGE_SIZE) - (aligned + rounded);
+        if (tail > 0) {
+            munmap(reinterpret_cast<void*>(aligned + rounded), tail);
+        }
+#ifdef MADV_HUGEPAGE
+        madvise(reinterpret_cast<void*>(aligned), rounded, MADV_HUGEPAGE);
+#endif
+        return reinterpret_cast<T*>(aligned);
+    }
+#endif
+    return static_cast<T*>(::operator new(bytes, std::align_val_t(alignof(T))));
+}
+
+template<typename T>
+void HugePageAllocator<T>::deallocate(T* pointer, size_t count) noexcept {
+    size_t bytes = count * sizeof(T);
+#if defined(__linux__)
+    if (bytes >= HUGE_PAGE_SIZE) {
+        munmap(pointer, (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE);
+        return;
+    }
+#endif
+    ::operator delete(pointer, std::align_val_t(alignof(T)));
+}
+
+template<typename T>
+template<typename U>
+bool HugePageAllocator<T>::operator==(const HugePageAllocator<U>&) const {
+    return true;
+}
+
+template<typename T>
+template<typename U>
+bool HugePageAllocator<T>::operator!=(const HugePageAllocator<U>&) const {
+    return false;
+}
+
+#endif
@@ -1,120 +1,1322 @@
-//==================== DYNAMIC ARRAY ====================
-#ifndef DYNAMIC_ARRAY_H
-#define DYNAMIC_ARRAY_H
+//==================== DYNAMIC ARRAY IMPLEMENTATION ====================
+#ifndef DYNAMIC_ARRAY_CPP
+#define DYNAMIC_ARRAY_CPP
+
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <utility>
+#include "../header/vectors.h"
+
+#ifdef DYNAMIC_ARRAY_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef DYNAMIC_ARRAY_USE_AVX2
+#include <immintrin.h>
+#endif
+
+//==================== INLINE BUFFER ====================
+
+template<typename T, size_t InlineCapacity>
+T* InlineBuffer<T, InlineCapacity>::inlineData() {
+    return reinterpret_cast<T*>(bytes);
+}
 
 template<typename T>
-class DynamicArray {
-private:
-    T* data;
-    size_t size;
-    size_t capacity;
-    
-    // Private helper functions to implement
-    void resize();
-    void reallocate(size_t new_capacity);
-    void copyData(const T* source, T* destination, size_t count);
-    void destroyElements();
-    void shiftElementsRight(size_t index, size_t positions);
-    void shiftElementsLeft(size_t index, size_t positions);
-    
-public:
-    // Constructors and Destructor
-    DynamicArray();
-    DynamicArray(size_t initial_capacity);
-    DynamicArray(size_t count, const T& value);
-    DynamicArray(const DynamicArray& other);
-    DynamicArray(DynamicArray&& other) noexcept;
-    ~DynamicArray();
-    
-    // Assignment operators
-    DynamicArray& operator=(const DynamicArray& other);
-    DynamicArray& operator=(DynamicArray&& other) noexcept;
-    
-    // Element access
-    T& operator[](size_t index);
-    const T& operator[](size_t index) const;
-    T& at(size_t index);
-    const T& at(size_t index) const;
-    T& front();
-    const T& front() const;
-    T& back();
-    const T& back() const;
-    T* getData();
-    const T* getData() const;
-    
-    // Capacity functions
-    size_t getSize() const;
-    size_t getCapacity() const;
-    bool empty() const;
-    void reserve(size_t new_capacity);
-    void shrinkToFit();
+T* InlineBuffer<T, 0>::inlineData() {
+    return nullptr;
+}
+
+//==================== SEARCH KERNELS ====================
+
+template<typename T>
+size_t SearchKernels<T>::find(const T* data, size_t size, T value) {
+#ifdef DYNAMIC_ARRAY_USE_AVX2
+    if (hasAvx2()) {
+        return findAvx2(data, size, value);
+    }
+#endif
+#ifdef DYNAMIC_ARRAY_USE_SSE2
+    return findSse2(data, size, value);
+#else
+    for (size_t i = 0; i < size; ++i) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return size;
+#endif
+}
+
+template<typename T>
+size_t SearchKernels<T>::findLast(const T* data, size_t size, T value) {
+#ifdef DYNAMIC_ARRAY_USE_AVX2
+    if (hasAvx2()) {
+        return findLastAvx2(data, size, value);
+    }
+#endif
+#ifdef DYNAMIC_ARRAY_USE_SSE2
+    return findLastSse2(data, size, value);
+#else
+    for (size_t i = size; i > 0; --i) {
+        if (data[i - 1] == value) {
+            return i - 1;
+        }
+    }
+    return size;
+#endif
+}
+
+template<typename T>
+size_t SearchKernels<T>::count(const T* data, size_t size, T value) {
+#ifdef DYNAMIC_ARRAY_USE_AVX2
+    if (hasAvx2()) {
+        return countAvx2(data, size, value);
+    }
+#endif
+#ifdef DYNAMIC_ARRAY_USE_SSE2
+    return countSse2(data, size, value);
+#else
+    size_t matches = 0;
+    for (size_t i = 0; i < size; ++i) {
+        if (data[i] == value) {
+            ++matches;
+        }
+    }
+    return matches;
+#endif
+}
+
+#ifdef DYNAMIC_ARRAY_USE_SSE2
+template<typename T>
+uint32_t SearchKernels<T>::matchSse2(const T* block, T value) {
+    __m128i equal;
+    if constexpr (std::is_floating_point<T>::value && sizeof(T) == 4) {
+        // Floating point compare, so NaN never matches and -0.0 matches 0.0
+        __m128 items = _mm_loadu_ps(reinterpret_cast<const float*>(block));
+        equal = _mm_castps_si128(_mm_cmpeq_ps(items, _mm_set1_ps(static_cast<float>(value))));
+    } else if constexpr (std::is_floating_point<T>::value) {
+        __m128d items = _mm_loadu_pd(reinterpret_cast<const double*>(block));
+        equal = _mm_castpd_si128(_mm_cmpeq_pd(items, _mm_set1_pd(static_cast<double>(value))));
+    } else {
+        __m128i items = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+        if constexpr (sizeof(T) == 1) {
+            equal = _mm_cmpeq_epi8(items, _mm_set1_epi8(static_cast<char>(value)));
+        } else if constexpr (sizeof(T) == 2) {
+            equal = _mm_cmpeq_epi16(items, _mm_set1_epi16(static_cast<short>(value)));
+        } else if constexpr (sizeof(T) == 4) {
+            equal = _mm_cmpeq_epi32(items, _mm_set1_epi32(static_cast<int>(value)));
+        } else {
+            // SSE2 has no 64-bit compare: both 32-bit halves must match
+            equal = _mm_cmpeq_epi32(items, _mm_set1_epi64x(static_cast<long long>(value)));
+            equal = _mm_and_si128(equal, _mm_shuffle_epi32(equal, 0xB1));
+        }
+    }
+    return static_cast<uint32_t>(_mm_movemask_epi8(equal));
+}
+
+template<typename T>
+size_t SearchKernels<T>::findSse2(const T* data, size_t size, T value) {
+    constexpr size_t LANES = 16 / sizeof(T);
+    size_t i = 0;
+    for (; i + LANES <= size; i += LANES) {
+        uint32_t mask = matchSse2(data + i, value);
+        if (mask) {
+            return i + lowestBit(mask) / sizeof(T);
+        }
+    }
+    for (; i < size; ++i) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return size;
+}
+
+template<typename T>
+size_t SearchKernels<T>::findLastSse2(const T* data, size_t size, T value) {
+    constexpr size_t LANES = 16 / sizeof(T);
+    size_t i = size;
+    for (; i >= LANES; i -= LANES) {
+        uint32_t mask = matchSse2(data + i - LANES, value);
+        if (mask) {
+            return i - LANES + highestBit(mask) / sizeof(T);
+        }
+    }
+    for (; i > 0; --i) {
+        if (data[i - 1] == value) {
+            return i - 1;
+        }
+    }
+    return size;
+}
+
+template<typename T>
+size_t SearchKernels<T>::countSse2(const T* data, size_t size, T value) {
+    constexpr size_t LANES = 16 / sizeof(T);
+    size_t matched_bits = 0;
+    size_t i = 0;
+    for (; i + LANES <= size; i += LANES) {
+        matched_bits += popCount(matchSse2(data + i, value));
+    }
+    size_t matches = matched_bits / sizeof(T);
+    for (; i < size; ++i) {
+        if (data[i] == value) {
+            ++matches;
+        }
+    }
+    return matches;
+}
+#endif
+
+#ifdef DYNAMIC_ARRAY_USE_AVX2
+template<typename T>
+DYNAMIC_ARRAY_AVX2_TARGET uint32_t SearchKernels<T>::matchAvx2(const T* block, T value) {
+    __m256i equal;
+    if constexpr (std::is_floating_point<T>::value && sizeof(T) == 4) {
+        __m256 items = _mm256_loadu_ps(reinterpret_cast<const float*>(block));
+        equal = _mm256_castps_si256(_mm256_cmp_ps(items, _mm256_set1_ps(static_cast<float>(value)), _CMP_EQ_OQ));
+    } else if constexpr (std::is_floating_point<T>::value) {
+        __m256d items = _mm256_loadu_pd(reinterpret_cast<const double*>(block));
+        equal = _mm256_castpd_si256(_mm256_cmp_pd(items, _mm256_set1_pd(static_cast<double>(value)), _CMP_EQ_OQ));
+    } else {
+        __m256i items = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+        if constexpr (sizeof(T) == 1) {
+            equal = _mm256_cmpeq_epi8(items, _mm256_set1_epi8(static_cast<char>(value)));
+        } else if constexpr (sizeof(T) == 2) {
+            equal = _mm256_cmpeq_epi16(items, _mm256_set1_epi16(static_cast<short>(value)));
+        } else if constexpr (sizeof(T) == 4) {
+            equal = _mm256_cmpeq_epi32(items, _mm256_set1_epi32(static_cast<int>(value)));
+        } else {
+            equal = _mm256_cmpeq_epi64(items, _mm256_set1_epi64x(static_cast<long long>(value)));
+        }
+    }
+    return static_cast<uint32_t>(_mm256_movemask_epi8(equal));
+}
+
+template<typename T>
+DYNAMIC_ARRAY_AVX2_TARGET size_t SearchKernels<T>::findAvx2(const T* data, size_t size, T value) {
+    constexpr size_t LANES = 32 / sizeof(T);
+    size_t i = 0;
+    for (; i + LANES <= size; i += LANES) {
+        uint32_t mask = matchAvx2(data + i, value);
+        if (mask) {
+            return i + lowestBit(mask) / sizeof(T);
+        }
+    }
+    for (; i < size; ++i) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return size;
+}
+
+template<typename T>
+DYNAMIC_ARRAY_AVX2_TARGET size_t SearchKernels<T>::findLastAvx2(const T* data, size_t size, T value) {
+    constexpr size_t LANES = 32 / sizeof(T);
+    size_t i = size;
+    for (; i >= LANES; i -= LANES) {
+        uint32_t mask = matchAvx2(data + i - LANES, value);
+        if (mask) {
+            return i - LANES + highestBit(mask) / sizeof(T);
+        }
+    }
+    for (; i > 0; --i) {
+        if (data[i - 1] == value) {
+            return i - 1;
+        }
+    }
+    return size;
+}
+
+template<typename T>
+DYNAMIC_ARRAY_AVX2_TARGET size_t SearchKernels<T>::countAvx2(const T* data, size_t size, T value) {
+    constexpr size_t LANES = 32 / sizeof(T);
+    size_t matched_bits = 0;
+    size_t i = 0;
+    for (; i + LANES <= size; i += LANES) {
+        matched_bits += popCount(matchAvx2(data + i, value));
+    }
+    size_t matches = matched_bits / sizeof(T);
+    for (; i < size; ++i) {
+        if (data[i] == value) {
+            ++matches;
+        }
+    }
+    return matches;
+}
+#endif
+
+template<typename T>
+bool SearchKernels<T>::hasAvx2() {
+#if defined(__AVX2__)
+    return true;
+#elif defined(DYNAMIC_ARRAY_USE_AVX2)
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+template<typename T>
+size_t SearchKernels<T>::lowestBit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_ctz(mask));
+#else
+    size_t index = 0;
+    while (!(mask & 1u)) {
+        mask >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+template<typename T>
+size_t SearchKernels<T>::highestBit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(31 - __builtin_clz(mask));
+#else
+    size_t index = 0;
+    while (mask >>= 1) {
+        ++index;
+    }
+    return index;
+#endif
+}
+
+template<typename T>
+size_t SearchKernels<T>::popCount(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_popcount(mask));
+#else
+    size_t bits = 0;
+    for (; mask; mask &= mask - 1) {
+        ++bits;
+    }
+    return bits;
+#endif
+}
+
+//==================== GROWTH POLICIES ====================
+
+inline size_t DoublingGrowth::grow(size_t capacity, size_t required) {
+    return std::max(required, capacity == 0 ? size_t(1) : capacity * 2);
+}
+
+inline size_t ThreeHalvesGrowth::grow(size_t capacity, size_t required) {
+    return std::max(required, capacity + capacity / 2 + 1);
+}
+
+template<size_t ChunkSize>
+size_t ChunkGrowth<ChunkSize>::grow(size_t, size_t required) {
+    static_assert(ChunkSize > 0, "ChunkGrowth needs a non-zero chunk size");
+    return (required + ChunkSize - 1) / ChunkSize * ChunkSize;
+}
+
+template<size_t Threshold>
+size_t ExactAfterThresholdGrowth<Threshold>::grow(size_t capacity, size_t required) {
+    if (required >= Threshold) {
+        return required;
+    }
+    return std::min(Threshold, std::max(required, capacity == 0 ? size_t(1) : capacity * 2));
+}
+
+//==================== PRIVATE HELPER FUNCTIONS ====================
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::resize() {
+    grow(capacity + 1);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::grow(size_t required) {
+    reallocate(Growth::grow(capacity, required));
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::reallocate(size_t new_capacity) {
+    // Never drops elements; a request that fits the inline buffer moves back into it
+    new_capacity = std::max(new_capacity, size);
+    T* target = new_capacity <= InlineCapacity ? this->inlineData()
+                                               : AllocatorTraits::allocate(allocator(), new_capacity);
+    if (target == data) {
+        return;
+    }
     
-    // Modifiers
-    void push_back(const T& value);
-    void push_back(T&& value);
-    template<typename... Args>
-    void emplace_back(Args&&... args);
-    void pop_back();
-    void insert(size_t index, const T& value);
-    void insert(size_t index, T&& value);
-    void insert(size_t index, size_t count, const T& value);
-    template<typename... Args>
-    void emplace(size_t index, Args&&... args);
-    void erase(size_t index);
-    void erase(size_t start_index, size_t end_index);
-    void clear();
-    void resize(size_t new_size);
-    void resize(size_t new_size, const T& value);
-    void assign(size_t count, const T& value);
-    void swap(DynamicArray& other);
+    if constexpr (IsTriviallyRelocatable<T>::value) {
+        if (size > 0) {
+            std::memcpy(static_cast<void*>(target), static_cast<const void*>(data), size * sizeof(T));
+        }
+    } else {
+        // Copies (for types without a noexcept move) may throw; the old buffer
+        // stays intact until every element has been built in the new one
+        size_t built = 0;
+        try {
+            for (; built < size; ++built) {
+                new (target + built) T(std::move_if_noexcept(data[built]));
+            }
+        } catch (...) {
+            for (size_t i = 0; i < built; ++i) {
+                target[i].~T();
+            }
+            if (target != this->inlineData()) {
+                AllocatorTraits::deallocate(allocator(), target, new_capacity);
+            }
+            throw;
+        }
+        destroyElements();
+    }
+    releaseStorage();
+    data = target;
+    capacity = std::max(new_capacity, InlineCapacity);
+    invalidateIterators();
     
-    // Search and comparison
-    bool contains(const T& value) const;
-    size_t find(const T& value) const;
-    size_t findLast(const T& value) const;
-    size_t count(const T& value) const;
-    bool equals(const DynamicArray& other) const;
+    if constexpr (Growth::track_stats) {
+        GrowthStats& stats = this->growth_stats;
+        ++stats.reallocations;
+        stats.bytes_copied += size * sizeof(T);
+        stats.peak_slack_bytes = std::max(stats.peak_slack_bytes, (capacity - size) * sizeof(T));
+    }
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::copyData(const T* source, T* destination, size_t count) {
+    // Destination is raw storage
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        if (count > 0) {
+            std::memcpy(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+        }
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            new (destination + i) T(source[i]);
+        }
+    }
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::destroyElements() {
+    for (size_t i = 0; i < size; ++i) {
+        data[i].~T();
+    }
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::shiftElementsRight(size_t index, size_t positions) {
+    // Opens a gap of raw storage at [index, index + positions); capacity must already fit
+    if (positions == 0) {
+        return;
+    }
+    if constexpr (IsTriviallyRelocatable<T>::value) {
+        std::memmove(static_cast<void*>(data + index + positions), static_cast<const void*>(data + index),
+                     (size - index) * sizeof(T));
+        return;
+    }
+    for (size_t i = size; i > index; --i) {
+        new (data + i - 1 + positions) T(std::move(data[i - 1]));
+        data[i - 1].~T();
+    }
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::shiftElementsLeft(size_t index, size_t positions) {
+    // Closes a gap of raw storage at [index, index + positions)
+    if (positions == 0) {
+        return;
+    }
+    if constexpr (IsTriviallyRelocatable<T>::value) {
+        std::memmove(static_cast<void*>(data + index), static_cast<const void*>(data + index + positions),
+                     (size - index - positions) * sizeof(T));
+        return;
+    }
+    for (size_t i = index + positions; i < size; ++i) {
+        new (data + i - positions) T(std::move(data[i]));
+        data[i].~T();
+    }
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::isInline() const {
+    return InlineCapacity > 0 && data == const_cast<DynamicArray*>(this)->inlineData();
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::releaseStorage() {
+    if (data && !isInline()) {
+        AllocatorTraits::deallocate(allocator(), data, capacity);
+    }
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::moveFrom(DynamicArray&& other) {
+    // Expects this array to be empty, on its own inline buffer, and to share
+    // other's allocator so a heap buffer can change hands. Throws only if
+    // moving an inline element does; this array then stays empty.
+    if (other.isInline()) {
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+            std::memcpy(static_cast<void*>(data), static_cast<const void*>(other.data), other.size * sizeof(T));
+        } else {
+            size_t built = 0;
+            try {
+                for (; built < other.size; ++built) {
+                    new (data + built) T(std::move(other.data[built]));
+                }
+            } catch (...) {
+                for (size_t i = 0; i < built; ++i) {
+                    data[i].~T();
+                }
+                throw;
+            }
+            other.destroyElements();
+        }
+        size = other.size;
+    } else {
+        data = other.data;
+        size = other.size;
+        capacity = other.capacity;
+        other.data = other.inlineData();
+        other.capacity = InlineCapacity;
+    }
+    other.size = 0;
+    invalidateIterators();
+    other.invalidateIterators();
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+Allocator& DynamicArray<T, InlineCapacity, Allocator, Growth>::allocator() {
+    return *this;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+const Allocator& DynamicArray<T, InlineCapacity, Allocator, Growth>::allocator() const {
+    return *this;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::resetToInline() {
+    data = this->inlineData();
+    capacity = InlineCapacity;
+    invalidateIterators();
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::invalidateIterators() {
+#if DYNAMIC_ARRAY_CHECKED_ITERATORS
+    ++generation;
+#endif
+}
+
+//==================== CONSTRUCTORS AND DESTRUCTOR ====================
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+DynamicArray<T, InlineCapacity, Allocator, Growth>::DynamicArray()
+    : Allocator(), data(this->inlineData()), size(0), capacity(InlineCapacity) {}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+DynamicArray<T, InlineCapacity, Allocator, Growth>::DynamicArray(const Allocator& allocator)
+    : Allocator(allocator), data(this->inlineData()), size(0), capacity(InlineCapacity) {}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+DynamicArray<T, InlineCapacity, Allocator, Growth>::DynamicArray(size_t initial_capacity, const Allocator& allocator)
+    : Allocator(allocator), data(this->inlineData()), size(0), capacity(InlineCapacity) {
+    reserve(initial_capacity);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+DynamicArray<T, InlineCapacity, Allocator, Growth>::DynamicArray(size_t count, const T& value, const Allocator& allocator)
+    : Allocator(allocator), data(this->inlineData()), size(0), capacity(InlineCapacity) {
+    assign(count, value);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+DynamicArray<T, InlineCapacity, Allocator, Growth>::DynamicArray(const DynamicArray& other)
+    : Allocator(AllocatorTraits::select_on_container_copy_construction(other.allocator())),
+      data(this->inlineData()), size(0), capacity(InlineCapacity) {
+    reserve(other.size);
+    copyData(other.data, data, other.size);
+    size = other.size;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+DynamicArray<T, InlineCapacity, Allocator, Growth>::DynamicArray(DynamicArray&& other) noexcept(NOTHROW_MOVE)
+    : Allocator(other.allocator()), data(this->inlineData()), size(0), capacity(InlineCapacity) {
+    moveFrom(std::move(other));
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+DynamicArray<T, InlineCapacity, Allocator, Growth>::~DynamicArray() {
+    destroyElements();
+    releaseStorage();
+}
+
+//==================== ASSIGNMENT OPERATORS ====================
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+DynamicArray<T, InlineCapacity, Allocator, Growth>& DynamicArray<T, InlineCapacity, Allocator, Growth>::operator=(const DynamicArray& other) {
+    if (this != &other) {
+        clear();
+        if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value) {
+            if (!(allocator() == other.allocator())) {
+                releaseStorage();
+                resetToInline();
+            }
+            allocator() = other.allocator();
+        }
+        reserve(other.size);
+        copyData(other.data, data, other.size);
+        size = other.size;
+    }
+    return *this;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+DynamicArray<T, InlineCapacity, Allocator, Growth>& DynamicArray<T, InlineCapacity, Allocator, Growth>::operator=(DynamicArray&& other) noexcept(NOTHROW_MOVE_ASSIGN) {
+    if (this != &other) {
+        destroyElements();
+        size = 0;
+        if (AllocatorTraits::propagate_on_container_move_assignment::value || allocator() == other.allocator()) {
+            releaseStorage();
+            resetToInline();
+            if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+                allocator() = other.allocator();
+            }
+            moveFrom(std::move(other));
+        } else if constexpr (!NOTHROW_MOVE_ASSIGN) {
+            // Memory from a different allocator cannot be adopted, move element
+            // by element; this array is left empty if that throws. Allocators
+            // that propagate or always compare equal never get here.
+            reserve(other.size);
+            size_t built = 0;
+            try {
+                for (; built < other.size; ++built) {
+                    new (data + built) T(std::move(other.data[built]));
+                }
+            } catch (...) {
+                for (size_t i = 0; i < built; ++i) {
+                    data[i].~T();
+                }
+                throw;
+            }
+            size = other.size;
+            other.clear();
+        }
+    }
+    return *this;
+}
+
+//==================== ELEMENT ACCESS ====================
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+Allocator DynamicArray<T, InlineCapacity, Allocator, Growth>::getAllocator() const {
+    return allocator();
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+T& DynamicArray<T, InlineCapacity, Allocator, Growth>::operator[](size_t index) {
+    return data[index];
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+const T& DynamicArray<T, InlineCapacity, Allocator, Growth>::operator[](size_t index) const {
+    return data[index];
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+T& DynamicArray<T, InlineCapacity, Allocator, Growth>::at(size_t index) {
+    if (index >= size) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    return data[index];
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+const T& DynamicArray<T, InlineCapacity, Allocator, Growth>::at(size_t index) const {
+    if (index >= size) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    return data[index];
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+T& DynamicArray<T, InlineCapacity, Allocator, Growth>::front() {
+    if (size == 0) {
+        throw std::runtime_error("Array is empty");
+    }
+    return data[0];
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+const T& DynamicArray<T, InlineCapacity, Allocator, Growth>::front() const {
+    if (size == 0) {
+        throw std::runtime_error("Array is empty");
+    }
+    return data[0];
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+T& DynamicArray<T, InlineCapacity, Allocator, Growth>::back() {
+    if (size == 0) {
+        throw std::runtime_error("Array is empty");
+    }
+    return data[size - 1];
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+const T& DynamicArray<T, InlineCapacity, Allocator, Growth>::back() const {
+    if (size == 0) {
+        throw std::runtime_error("Array is empty");
+    }
+    return data[size - 1];
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+T* DynamicArray<T, InlineCapacity, Allocator, Growth>::getData() {
+    return data;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+const T* DynamicArray<T, InlineCapacity, Allocator, Growth>::getData() const {
+    return data;
+}
+
+//==================== CAPACITY FUNCTIONS ====================
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+size_t DynamicArray<T, InlineCapacity, Allocator, Growth>::getSize() const {
+    return size;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+size_t DynamicArray<T, InlineCapacity, Allocator, Growth>::getCapacity() const {
+    return capacity;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::empty() const {
+    return size == 0;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::reserve(size_t new_capacity) {
+    if (new_capacity > capacity) {
+        reallocate(new_capacity);
+    }
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::shrinkToFit() {
+    if (size < capacity) {
+        reallocate(size);
+    }
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+GrowthStats DynamicArray<T, InlineCapacity, Allocator, Growth>::getGrowthStats() const {
+    if constexpr (Growth::track_stats) {
+        return this->growth_stats;
+    } else {
+        return GrowthStats();
+    }
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::resetGrowthStats() {
+    if constexpr (Growth::track_stats) {
+        this->growth_stats = GrowthStats();
+    }
+}
+
+//==================== MODIFIERS ====================
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::push_back(const T& value) {
+    if (size == capacity) {
+        // value may live in this array, copy it before the buffer moves
+        T copy(value);
+        resize();
+        new (data + size) T(std::move(copy));
+    } else {
+        new (data + size) T(value);
+    }
+    ++size;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::push_back(T&& value) {
+    if (size == capacity) {
+        T moved(std::move(value));
+        resize();
+        new (data + size) T(std::move(moved));
+    } else {
+        new (data + size) T(std::move(value));
+    }
+    ++size;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+template<typename... Args>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::emplace_back(Args&&... args) {
+    if (size == capacity) {
+        T element(std::forward<Args>(args)...);
+        resize();
+        new (data + size) T(std::move(element));
+    } else {
+        new (data + size) T(std::forward<Args>(args)...);
+    }
+    ++size;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::pop_back() {
+    if (size == 0) {
+        throw std::runtime_error("Array is empty");
+    }
+    data[--size].~T();
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::insert(size_t index, const T& value) {
+    emplace(index, value);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::insert(size_t index, T&& value) {
+    emplace(index, std::move(value));
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::insert(size_t index, size_t count, const T& value) {
+    if (index > size) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    if (count == 0) {
+        return;
+    }
     
-    // Iterator class
-    class Iterator {
-    private:
-        T* ptr;
-    public:
-        Iterator(T* p);
-        Iterator(const Iterator& other);
-        Iterator& operator=(const Iterator& other);
-        T& operator*();
-        const T& operator*() const;
-        T* operator->();
-        const T* operator->() const;
-        Iterator& operator++();
-        Iterator operator++(int);
-        Iterator& operator--();
-        Iterator operator--(int);
-        Iterator operator+(size_t n) const;
-        Iterator operator-(size_t n) const;
-        Iterator& operator+=(size_t n);
-        Iterator& operator-=(size_t n);
-        ptrdiff_t operator-(const Iterator& other) const;
-        bool operator==(const Iterator& other) const;
-        bool operator!=(const Iterator& other) const;
-        bool operator<(const Iterator& other) const;
-        bool operator>(const Iterator& other) const;
-        bool operator<=(const Iterator& other) const;
-        bool operator>=(const Iterator& other) const;
-        T& operator[](size_t n);
-        const T& operator[](size_t n) const;
-    };
+    T copy(value);
+    if (size + count > capacity) {
+        grow(size + count);
+    }
+    shiftElementsRight(index, count);
+    for (size_t i = 0; i < count; ++i) {
+        new (data + index + i) T(copy);
+    }
+    size += count;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+template<typename... Args>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::emplace(size_t index, Args&&... args) {
+    if (index > size) {
+        throw std::out_of_range("Index out of bounds");
+    }
     
-    // Iterator functions
-    Iterator begin();
-    Iterator end();
-    const Iterator begin() const;
-    const Iterator end() const;
-    Iterator rbegin();
-    Iterator rend();
-    const Iterator rbegin() const;
-    const Iterator rend() const;
-};
-
-#endif
\ No newline at end of file
+    // Build the element first, the arguments may refer into this array
+    T element(std::forward<Args>(args)...);
+    if (size == capacity) {
+        resize();
+    }
+    shiftElementsRight(index, 1);
+    new (data + index) T(std::move(element));
+    ++size;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::erase(size_t index) {
+    if (index >= size) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    data[index].~T();
+    shiftElementsLeft(index, 1);
+    --size;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::erase(size_t start_index, size_t end_index) {
+    // Removes [start_index, end_index)
+    if (start_index > end_index || end_index > size) {
+        throw std::out_of_range("Index out of bounds");
+    }
+    for (size_t i = start_index; i < end_index; ++i) {
+        data[i].~T();
+    }
+    shiftElementsLeft(start_index, end_index - start_index);
+    size -= end_index - start_index;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::clear() {
+    destroyElements();
+    size = 0;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::resize(size_t new_size) {
+    if (new_size < size) {
+        for (size_t i = new_size; i < size; ++i) {
+            data[i].~T();
+        }
+    } else {
+        reserve(new_size);
+        for (size_t i = size; i < new_size; ++i) {
+            new (data + i) T();
+        }
+    }
+    size = new_size;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::resize(size_t new_size, const T& value) {
+    if (new_size <= size) {
+        resize(new_size);
+        return;
+    }
+    T copy(value);
+    reserve(new_size);
+    for (size_t i = size; i < new_size; ++i) {
+        new (data + i) T(copy);
+    }
+    size = new_size;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::assign(size_t count, const T& value) {
+    T copy(value);
+    clear();
+    reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        new (data + i) T(copy);
+    }
+    size = count;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+void DynamicArray<T, InlineCapacity, Allocator, Growth>::swap(DynamicArray& other) {
+    bool same_allocator = AllocatorTraits::propagate_on_container_swap::value || allocator() == other.allocator();
+    if (!isInline() && !other.isInline() && same_allocator) {
+        std::swap(data, other.data);
+        std::swap(size, other.size);
+        std::swap(capacity, other.capacity);
+        invalidateIterators();
+        other.invalidateIterators();
+        if constexpr (AllocatorTraits::propagate_on_container_swap::value) {
+            std::swap(allocator(), other.allocator());
+        }
+        return;
+    }
+    // Inline elements, or buffers from unequal allocators, cannot trade places by pointer
+    DynamicArray temp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(temp);
+}
+
+//==================== SEARCH AND COMPARISON ====================
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::contains(const T& value) const {
+    return find(value) != size;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+size_t DynamicArray<T, InlineCapacity, Allocator, Growth>::find(const T& value) const {
+    if constexpr (SearchKernels<T>::vectorizable) {
+        return SearchKernels<T>::find(data, size, value);
+    } else {
+        for (size_t i = 0; i < size; ++i) {
+            if (data[i] == value) {
+                return i;
+            }
+        }
+        return size;
+    }
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+size_t DynamicArray<T, InlineCapacity, Allocator, Growth>::findLast(const T& value) const {
+    if constexpr (SearchKernels<T>::vectorizable) {
+        return SearchKernels<T>::findLast(data, size, value);
+    } else {
+        for (size_t i = size; i > 0; --i) {
+            if (data[i - 1] == value) {
+                return i - 1;
+            }
+        }
+        return size;
+    }
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+size_t DynamicArray<T, InlineCapacity, Allocator, Growth>::count(const T& value) const {
+    if constexpr (SearchKernels<T>::vectorizable) {
+        return SearchKernels<T>::count(data, size, value);
+    } else {
+        size_t matches = 0;
+        for (size_t i = 0; i < size; ++i) {
+            if (data[i] == value) {
+                ++matches;
+            }
+        }
+        return matches;
+    }
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::equals(const DynamicArray& other) const {
+    if (size != other.size) {
+        return false;
+    }
+    for (size_t i = 0; i < size; ++i) {
+        if (!(data[i] == other.data[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//==================== ITERATOR IMPLEMENTATION ====================
+
+#if DYNAMIC_ARRAY_CHECKED_ITERATORS
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::Iterator(T* p, const DynamicArray* array)
+    : ptr(p), array(array), generation(array->generation) {}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::Iterator(const Iterator& other)
+    : ptr(other.ptr), array(other.array), generation(other.generation) {}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+T* DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::checked(size_t n) const {
+    if (generation != array->generation) {
+        throw std::logic_error("Iterator used after the array reallocated");
+    }
+    // Unsigned compare also catches positions before the first element
+    size_t index = static_cast<size_t>(ptr - array->data) + n;
+    if (index >= array->size) {
+        throw std::out_of_range("Iterator out of bounds");
+    }
+    return array->data + index;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator& DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator=(const Iterator& other) {
+    ptr = other.ptr;
+    array = other.array;
+    generation = other.generation;
+    return *this;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+T& DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator*() {
+    return *checked(0);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+const T& DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator*() const {
+    return *checked(0);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+T* DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator->() {
+    return checked(0);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+const T* DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator->() const {
+    return checked(0);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator& DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator++() {
+    ++ptr;
+    return *this;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator++(int) {
+    Iterator temp(*this);
+    ++ptr;
+    return temp;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator& DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator--() {
+    --ptr;
+    return *this;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator--(int) {
+    Iterator temp(*this);
+    --ptr;
+    return temp;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator+(size_t n) const {
+    return Iterator(*this) += n;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator-(size_t n) const {
+    return Iterator(*this) -= n;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator& DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator+=(size_t n) {
+    ptr += n;
+    return *this;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator& DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator-=(size_t n) {
+    ptr -= n;
+    return *this;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+ptrdiff_t DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator-(const Iterator& other) const {
+    if (array != other.array) {
+        throw std::logic_error("Iterators belong to different arrays");
+    }
+    return ptr - other.ptr;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator==(const Iterator& other) const {
+    return ptr == other.ptr;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator!=(const Iterator& other) const {
+    return ptr != other.ptr;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator<(const Iterator& other) const {
+    return ptr < other.ptr;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator>(const Iterator& other) const {
+    return ptr > other.ptr;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator<=(const Iterator& other) const {
+    return ptr <= other.ptr;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator>=(const Iterator& other) const {
+    return ptr >= other.ptr;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+T& DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator[](size_t n) {
+    return *checked(n);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+const T& DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator::operator[](size_t n) const {
+    return *checked(n);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::ConstIterator(const T* p, const DynamicArray* array)
+    : ptr(p), array(array), generation(array->generation) {}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::ConstIterator(const Iterator& other)
+    : ptr(other.ptr), array(other.array), generation(other.generation) {}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::ConstIterator(const ConstIterator& other)
+    : ptr(other.ptr), array(other.array), generation(other.generation) {}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+const T* DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::checked(size_t n) const {
+    if (generation != array->generation) {
+        throw std::logic_error("Iterator used after the array reallocated");
+    }
+    size_t index = static_cast<size_t>(ptr - array->data) + n;
+    if (index >= array->size) {
+        throw std::out_of_range("Iterator out of bounds");
+    }
+    return array->data + index;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator& DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator=(const ConstIterator& other) {
+    ptr = other.ptr;
+    array = other.array;
+    generation = other.generation;
+    return *this;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+const T& DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator*() const {
+    return *checked(0);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+const T* DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator->() const {
+    return checked(0);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator& DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator++() {
+    ++ptr;
+    return *this;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator++(int) {
+    ConstIterator temp(*this);
+    ++ptr;
+    return temp;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator& DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator--() {
+    --ptr;
+    return *this;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator--(int) {
+    ConstIterator temp(*this);
+    --ptr;
+    return temp;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator+(size_t n) const {
+    return ConstIterator(*this) += n;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator-(size_t n) const {
+    return ConstIterator(*this) -= n;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator& DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator+=(size_t n) {
+    ptr += n;
+    return *this;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator& DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator-=(size_t n) {
+    ptr -= n;
+    return *this;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+ptrdiff_t DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator-(const ConstIterator& other) const {
+    if (array != other.array) {
+        throw std::logic_error("Iterators belong to different arrays");
+    }
+    return ptr - other.ptr;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator==(const ConstIterator& other) const {
+    return ptr == other.ptr;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator!=(const ConstIterator& other) const {
+    return ptr != other.ptr;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator<(const ConstIterator& other) const {
+    return ptr < other.ptr;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator>(const ConstIterator& other) const {
+    return ptr > other.ptr;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator<=(const ConstIterator& other) const {
+    return ptr <= other.ptr;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+bool DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator>=(const ConstIterator& other) const {
+    return ptr >= other.ptr;
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+const T& DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator::operator[](size_t n) const {
+    return *checked(n);
+}
+#endif
+
+//==================== ITERATOR FUNCTIONS ====================
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator DynamicArray<T, InlineCapacity, Allocator, Growth>::makeIterator(T* position) const {
+#if DYNAMIC_ARRAY_CHECKED_ITERATORS
+    return Iterator(position, this);
+#else
+    return position;
+#endif
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator DynamicArray<T, InlineCapacity, Allocator, Growth>::makeConstIterator(const T* position) const {
+#if DYNAMIC_ARRAY_CHECKED_ITERATORS
+    return ConstIterator(position, this);
+#else
+    return position;
+#endif
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator DynamicArray<T, InlineCapacity, Allocator, Growth>::begin() {
+    return makeIterator(data);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::Iterator DynamicArray<T, InlineCapacity, Allocator, Growth>::end() {
+    return makeIterator(data + size);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator DynamicArray<T, InlineCapacity, Allocator, Growth>::begin() const {
+    return makeConstIterator(data);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstIterator DynamicArray<T, InlineCapacity, Allocator, Growth>::end() const {
+    return makeConstIterator(data + size);
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ReverseIterator DynamicArray<T, InlineCapacity, Allocator, Growth>::rbegin() {
+    return ReverseIterator(end());
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ReverseIterator DynamicArray<T, InlineCapacity, Allocator, Growth>::rend() {
+    return ReverseIterator(begin());
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstReverseIterator DynamicArray<T, InlineCapacity, Allocator, Growth>::rbegin() const {
+    return ConstReverseIterator(end());
+}
+
+template<typename T, size_t InlineCapacity, typename Allocator, typename Growth>
+typename DynamicArray<T, InlineCapacity, Allocator, Growth>::ConstReverseIterator DynamicArray<T, InlineCapacity, Allocator, Growth>::rend() const {
+    return ConstReverseIterator(begin());
+}
+
+#endif